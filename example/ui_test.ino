@@ -25,47 +25,69 @@ XPT2046_Touchscreen ts(CS_PIN);
 #define TFT_SCLK 13
 #define TFT_MISO 12
 //TFT instance
+#if defined(NOFRAMEBUFFER) && defined(DISPLAYLIST)
+//without framebuffer: the rectangles of a frame are recorded and sent optimized (see DisplayList.h)
+DisplayList tft = DisplayList(TFT_CS, TFT_DC, TFT_RST, TFT_MOSI, TFT_SCLK, TFT_MISO);
+DisplayOp displayOps[400];
+#else
 ILI9486_t3n tft = ILI9486_t3n(TFT_CS, TFT_DC, TFT_RST, TFT_MOSI, TFT_SCLK, TFT_MISO);
+#endif
+
+//updates per second, shown by lblUPS
+float ups = 0;
+
+//value of sl1, shown by bg1 and dg1
+Observable sl1Value;
 
 //graphical user interface instance
 BUI ui = BUI(&tft, &ts);
 
-//ui buttons
-Button btn1 = Button(10, 280, 100, 30, (char *)"Settings", &btn1_onClickHandler);
-Button btnMain = Button(10, 280, 100, 30, (char *)"Main");
+//ui buttons (positions are set by the layouts below)
+Button btn1 = Button(0, 0, 100, 30, (char *)"Settings", &btn1_onClickHandler);
+Button btnMain = Button(0, 0, 100, 30, (char *)"Main");
 
 //ui labels
-Label lblTitleMain = Label(10, 10, (char *)"Main screen", Arial_32);
-Label lblTitle2nd = Label(10, 10, (char *)"Settings", Arial_32);
-Label lblRunningtime = Label(10, 100, (char *)"Milliseconds since the program started:", Arial_12);
-Label lblMillis = Label(300, 100, (char *)"0", Arial_12);
-Label lblUPS = Label(300, 10, (char *)"0", Arial_12); //updates per second
+Label lblTitleMain = Label(0, 0, (char *)"Main screen", Arial_32);
+Label lblTitle2nd = Label(0, 0, (char *)"Settings", Arial_32);
+Label lblRunningtime = Label(0, 0, (char *)"Milliseconds since the program started:", Arial_12);
+Label lblMillis = Label(0, 0, (char *)"0", Arial_12);
+NumericLabel lblUPS = NumericLabel(0, 0, &ups, 0, Arial_12); //updates per second (shows the value of ups)
 
 //ui checkbox
-CheckBox cb1 = CheckBox(10, 100, (char *)"Show millis on main screen");
-CheckBox cb2 = CheckBox(10, 125, (char *)"Enable darkmode", &cb2_onClickHandler);
+CheckBox cb1 = CheckBox(0, 0, (char *)"Show millis on main screen");
+CheckBox cb2 = CheckBox(0, 0, (char *)"Enable darkmode", &cb2_onClickHandler);
 
 //ui slider
-Slider sl1 = Slider(10, 175, 200, 24, 0, 132, &sl1_onChangeHandler);
+Slider sl1 = Slider(0, 0, 200, 24, 0, 132);
 
 //ui NumericUpDown
-NumericUpDown numUD = NumericUpDown(10, 225, 100, 32, -10, 10);
+NumericUpDown numUD = NumericUpDown(0, 0, 100, 32, -10, 10);
 
 //ui BarGraph
-BarGraph bg1 = BarGraph(250, 150, 40, 100, 0, 132, 0x07E0, (char*)"sl1_val");
+BarGraph bg1 = BarGraph(0, 0, 40, 100, 0, 132, 0x07E0, (char*)"sl1_val");
 
 //ui DonutGraph
-DonutGraph dg1 = DonutGraph(320, 150, 0, 132, 0xFFFF, (char*)"sl1_val");
+DonutGraph dg1 = DonutGraph(0, 0, 0, 132, 0xFFFF, (char*)"sl1_val");
 
 //ui DropDown
-DropDown dd1 = DropDown(10, 125, 150, 32);
+DropDown dd1 = DropDown(0, 0, 150, 32);
 
 //ui TextBox
-TextBox tb1 = TextBox(10, 165, 150, 32, &tb1_onClickHandler);
+TextBox tb1 = TextBox(0, 0, 150, 32, &tb1_onClickHandler);
 
 //ui NumPad
 NumPad np1 = NumPad(200, &np1_onClickHandler);
 
+//ui layouts: the controls are placed for the size of the display (e.g. 480x320 or 320x240)
+Layout mainScreen = Layout(LAYOUTANCHOR);
+Layout mainPage = Layout(LAYOUTVSTACK);
+Layout runningTime = Layout(LAYOUTHSTACK);
+Layout settingsScreen = Layout(LAYOUTANCHOR);
+Layout settingsPage = Layout(LAYOUTVSTACK);
+Layout settingsRow = Layout(LAYOUTHSTACK);
+Layout settingsColumn = Layout(LAYOUTVSTACK);
+Layout graphs = Layout(LAYOUTHSTACK);
+
 void setup()
 {
   //init Serial if needed
@@ -73,6 +95,9 @@ void setup()
 
   // Init TFT (tft.begin(); is executed in the initialization of ui)
   tft.setRotation(3);
+#if defined(NOFRAMEBUFFER) && defined(DISPLAYLIST)
+  tft.setBuffer(displayOps, 400);
+#endif
 
   //init touch (ts.begin(); is executed in the initialization of ui)
   ts.setRotation(3);
@@ -99,6 +124,11 @@ void setup()
   //[optional] set handler on btn3 dynamically
   btnMain.setOnClickHandler(&btnMain_onClickHandler); 
 
+  //[optional] bind controls to one value: moving sl1 updates bg1 and dg1
+  sl1.bind(&sl1Value);
+  bg1.bind(&sl1Value);
+  dg1.bind(&sl1Value);
+
   //[optional] set barGraph1 colors yellow and red, for values >= 60 & >= 80 
   bg1.addValueColor(60, 0xFFE0); //yellow
   bg1.addValueColor(80, 0xF800); //red
@@ -116,6 +146,38 @@ void setup()
   //[optional] set selectedIndex for DropDown
   dd1.setSelectedIndex(0);
 
+  //ups is aligned right, so a longer value grows to the left instead of off the screen
+  lblUPS.textAlign = ALIGNRIGHT;
+
+  //main screen: title, running time, dropDown and textBox one below the other, ups top right, button bottom left
+  runningTime.add(&lblRunningtime);
+  runningTime.add(&lblMillis);
+  mainPage.add(&lblTitleMain);
+  mainPage.add(&runningTime);
+  mainPage.add(&dd1);
+  mainPage.add(&tb1);
+  mainScreen.add(&mainPage, 0, 0, LAYOUTLEFT | LAYOUTRIGHT | LAYOUTTOP);
+  mainScreen.add(&lblUPS, 0, 0, LAYOUTTOP | LAYOUTRIGHT);
+  mainScreen.add(&btn1, 0, 0, LAYOUTLEFT | LAYOUTBOTTOM);
+  mainScreen.padding = 10;
+
+  //settings screen: the graphs right of the settings
+  settingsColumn.add(&cb1);
+  settingsColumn.add(&cb2);
+  settingsColumn.add(&sl1);
+  settingsColumn.add(&numUD);
+  graphs.add(&bg1);
+  graphs.add(&dg1);
+  settingsRow.add(&settingsColumn);
+  settingsRow.add(&graphs);
+  settingsRow.spacing = 20;
+  settingsPage.add(&lblTitle2nd);
+  settingsPage.add(&settingsRow);
+  settingsScreen.add(&settingsPage, 0, 0, LAYOUTLEFT | LAYOUTRIGHT | LAYOUTTOP);
+  settingsScreen.add(&lblUPS, 0, 0, LAYOUTTOP | LAYOUTRIGHT);
+  settingsScreen.add(&btnMain, 0, 0, LAYOUTLEFT | LAYOUTBOTTOM);
+  settingsScreen.padding = 10;
+
   ui.calibrateTouch();
 
   //start with some screen
@@ -124,8 +186,6 @@ void setup()
 
 unsigned long endUpdate = 0;
 unsigned long startUpdate = 0;
-char vOut [11];
-char v2Out [11];
 
 void loop()
 {
@@ -133,9 +193,7 @@ void loop()
   
   if(cb1.checked)
   {
-    ultoa(millis(), vOut, 10);
-    
-    lblMillis.setText(vOut);
+    lblMillis.setText((long)millis());
   }
   else
   {
@@ -147,10 +205,8 @@ void loop()
   //save last update time for benchmark updates per second
   endUpdate = millis();
 
-  //print ups (benchmark updates per second)
-  float ups = 1000.0f / (float)(endUpdate - startUpdate);
-  ultoa(ups, v2Out, 10);
-  lblUPS.setText(v2Out);
+  //benchmark updates per second (lblUPS shows it with the next update)
+  ups = 1000.0f / (float)(endUpdate - startUpdate);
 }
 
 /*
@@ -159,7 +215,7 @@ void loop()
 void getMainScreen()
 {
   //[important] init is necessary before adding controls to a new window
-  ui.init();
+  ui.initNewScreen();
 
   //[important] Add controls to ui
   ui.addControl(&lblTitleMain);
@@ -170,12 +226,15 @@ void getMainScreen()
   ui.addControl(&tb1);
   ui.addControl(&np1);
   ui.addControl(&btn1);
+
+  //[optional] place the controls
+  ui.setLayout(&mainScreen);
 }
 
 void get2ndScreen()
 {
   //[important] init is necessary before adding controls to a new window
-  ui.init();
+  ui.initNewScreen();
 
   //[important] Add controls to ui
   ui.addControl(&lblTitle2nd);
@@ -187,6 +246,9 @@ void get2ndScreen()
   ui.addControl(&dg1);
   ui.addControl(&numUD);
   ui.addControl(&btnMain);
+
+  //[optional] place the controls
+  ui.setLayout(&settingsScreen);
 }
 
 /*
@@ -207,12 +269,6 @@ void cb2_onClickHandler()
   ui.enableDarkmode(cb2.checked);
 }
 
-void sl1_onChangeHandler()
-{
-  bg1.setValue(sl1.getValue());
-  dg1.setValue(sl1.getValue());
-}
-
 void tb1_onClickHandler()
 {
   np1.enabled = true;
@@ -0,0 +1,103 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Tweens run by BUI::update(). A tween moves a value from one number to another over some milliseconds and
+ * hands it to a control (applyValue, like a binding), an Observable or a function of the sketch:
+ *   ui.animate(&dg1, dg1.getValue(), 80, 400);          // the donut eases to 80 in 400 ms
+ *   ui.animate(&level, 0, 250, EASEOUT);                // Observable, bound controls follow
+ *   ui.animate(&setNeedleAngle, 0, 270, 1000);          // anything else: void setNeedleAngle(float angle)
+ * Only the animated controls get dirty, with redraw on change only their tiles are repainted.
+ * While nothing is animated, the scheduler costs one compare per update.
+ */
+
+// tweens running at the same time
+#ifndef MAXANIMATIONS
+#define MAXANIMATIONS 8
+#endif
+
+// easings
+#define EASELINEAR 0
+#define EASEIN 1
+#define EASEOUT 2
+#define EASEINOUT 3
+#define EASEOUTBACK 4 // overshoots a little and settles, e.g. for a snapping knob
+
+class Control;
+class Observable;
+
+class Animation
+{
+public:
+    // progress 0..65536 to eased progress (EASEOUTBACK goes above 65536 for a while)
+    static int32_t ease(uint32_t progress, uint8_t easing)
+    {
+        if (progress >= 65536)
+            return 65536;
+
+        int64_t p = progress;
+        switch (easing)
+        {
+        case EASEIN:
+            return p * p >> 16;
+        case EASEOUT:
+        {
+            int64_t q = 65536 - p;
+            return 65536 - (q * q >> 16);
+        }
+        case EASEINOUT:
+        {
+            // smoothstep 3p^2 - 2p^3
+            int64_t p2 = p * p >> 16;
+            int64_t p3 = p2 * p >> 16;
+            return 3 * p2 - 2 * p3;
+        }
+        case EASEOUTBACK:
+        {
+            // 1 + 2.70158 (p - 1)^3 + 1.70158 (p - 1)^2
+            int64_t q = p - 65536;
+            int64_t q2 = q * q >> 16;
+            int64_t q3 = q2 * q >> 16;
+            return 65536 + (177051 * q3 >> 16) + (111515 * q2 >> 16);
+        }
+        default:
+            return progress;
+        }
+    }
+
+private:
+    friend class BUI;
+
+    enum
+    {
+        CONTROL,
+        OBSERVABLE,
+        FUNCTION
+    };
+
+    bool active = false;
+    uint8_t kind = CONTROL;
+    uint8_t easing = EASELINEAR;
+    void *target = NULL;
+    void (*function)(float) = nullptr;
+    float from = 0;
+    float to = 0;
+    uint32_t start = 0;
+    uint32_t duration = 1;
+
+    // value at now, false once the end value is reached
+    bool value(uint32_t now, float &value)
+    {
+        uint32_t elapsed = now - start;
+        if (elapsed >= duration)
+        {
+            value = to;
+            return false;
+        }
+
+        uint32_t progress = ((uint64_t)elapsed << 16) / duration;
+        value = from + (to - from) * ease(progress, easing) / 65536.0f;
+        return true;
+    }
+};
@@ -6,11 +6,33 @@
 
 #include "Arduino.h"
 #include "Control.h"
+#include "UpdateQueue.h"
+#include "PaletteFrame.h"
+#include "FrameDiff.h"
+#include "Animation.h"
+#include "Layout.h"
+#ifdef PIPELINE
+#include "Parallel.h"
+#include "TileRenderer.h"
+#endif
 
 class BUI
 {
 //Maximum controls per Window
 #define MAXCONTROLS 24 //max max ist 256 (uint8_t)
+//Maximum queues for updates from interrupts or other tasks
+#define MAXUPDATEQUEUES 4
+
+//tiles of the repainted area in enableRedrawOnChange mode (32 tiles per row), on displays larger than 32 * TILESIZE
+//by TILEROWS * TILESIZE pixels the tiles are made larger (see tileSize())
+#define TILESIZE 32
+#define TILEROWS 16
+
+//framebuffer DMA of the t3n libs (enableAsyncUpdate)
+#if !defined(NOFRAMEBUFFER) && (defined(_ILI9341_t3NH_) || defined(_ILI9486_t3NH_))
+#define ASYNCUPDATE
+#define FRAMEDIFF
+#endif
 
 public:
     //Touchscreen calibration for my ILI9486
@@ -34,17 +56,43 @@ public:
 
     BUI(){};
 
+#ifdef PIPELINE
+    ~BUI()
+    {
+        enablePipeline(NULL, 0);
+    }
+#endif
+
     void initNewScreen()
     {
         for (uint8_t i = 0; i < MAXCONTROLS; i++)
         {
             _controls[i] = nullptr;//new Control;
         }
+        _layout = NULL;
+        _redraw = true;
+    }
+
+    //places the controls of the screen (see Layout.h), after initNewScreen()
+    void setLayout(Layout *layout)
+    {
+        _layout = layout;
+        if (_layout != NULL)
+            _layout->invalidate();
+        _redraw = true;
     }
 
     void setBackColor(uint16_t bgColor)
     {
         _bgColor = bgColor;
+        _redraw = true;
+    }
+
+    // only repaint if a control changed (setters, bindings, touch or invalidate()), instead of every update
+    void enableRedrawOnChange(bool enable)
+    {
+        redrawOnChange = enable;
+        _redraw = true;
     }
 
     bool addControl(Control *control)
@@ -71,19 +119,108 @@ public:
         return false;
     }
 
+    //updates from an interrupt or another task, applied with the next update() (see UpdateQueue.h)
+    bool post(Control *control, float value)
+    {
+        return _queue.post(control, value);
+    }
+
+    bool post(Control *control, const char *text)
+    {
+        return _queue.post(control, text);
+    }
+
+    bool post(Observable *observable, float value)
+    {
+        return _queue.post(observable, value);
+    }
+
+    //queue of another producer
+    bool addUpdateQueue(UpdateQueue *queue)
+    {
+        for (uint8_t i = 0; i < MAXUPDATEQUEUES; i++)
+        {
+            if (_queues[i] == nullptr || _queues[i] == queue)
+            {
+                _queues[i] = queue;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    //tweens (see Animation.h), a new tween of the same target replaces the running one
+    bool animate(Control *control, float from, float to, uint32_t ms, uint8_t easing = EASEINOUT)
+    {
+        Animation *a = startAnimation(control, Animation::CONTROL, from, to, ms, easing);
+        return a != NULL;
+    }
+
+    //from the current value
+    bool animate(Observable *value, float to, uint32_t ms, uint8_t easing = EASEINOUT)
+    {
+        Animation *a = startAnimation(value, Animation::OBSERVABLE, value->get(), to, ms, easing);
+        return a != NULL;
+    }
+
+    bool animate(void (*function)(float), float from, float to, uint32_t ms, uint8_t easing = EASEINOUT)
+    {
+        Animation *a = startAnimation((void *)function, Animation::FUNCTION, from, to, ms, easing);
+        if (a != NULL)
+            a->function = function;
+        return a != NULL;
+    }
+
+    //stops where it is
+    void stopAnimation(const void *target)
+    {
+        for (uint8_t i = 0; i < MAXANIMATIONS; i++)
+        {
+            if (_animations[i].active && _animations[i].target == target)
+            {
+                _animations[i].active = false;
+                _animating--;
+            }
+        }
+    }
+
+    bool isAnimating()
+    {
+        return _animating > 0;
+    }
+
     void update()
     {
-        _tft->fillScreen(_bgColor);
+        if (input())
+            render();
+    };
+
+    //first half of update(): posted updates, touch, click handlers and bindings
+    //returns false if a click handler ran (it may have built a new screen), then render() is skipped by update()
+    bool input()
+    {
+        //only arranged again if the layout or the display changed
+        if (_layout != NULL && _layout->arrange(_tft))
+            _redraw = true;
+
+        applyUpdates();
+        if (_animating > 0)
+            animateStep(millis());
 
         TS_Point p;
         uint32_t now = millis();
+        bool touched = false;
 
         if (_ts->touched())
         {
-            if (now - lastTouch >= touchDelay || (lastTouchedType == SLIDER && now - lastTouch >= shortTouchDelay)) //
+            //sliders, open dropDowns and touched panels (scrolled by dragging) follow the finger
+            bool follow = lastTouchedType == SLIDER || ((lastTouchedType == DROPDOWN || lastTouchedType == PANEL) && priorizedControl >= 0);
+            if (now - lastTouch >= touchDelay || (follow && now - lastTouch >= shortTouchDelay))
             {
                 lastTouch = millis();
                 lastTouchedType = UNDEFINED;
+                touched = true;
 
                 p = _ts->getPoint();
 
@@ -95,7 +232,7 @@ public:
         }
 
         //check for priorized clickHandler
-        int8_t priorizedControl = -1;
+        priorizedControl = -1;
 
         for (uint8_t i = 0; i < MAXCONTROLS; i++)
         {
@@ -107,9 +244,19 @@ public:
                     {
                         lastTouchedType = _controls[i]->getType();
 
-                        _controls[i]->internalOnClickHandler(p.x, p.y);
+                        Control *control = _controls[i];
+                        control->internalOnClickHandler(p.x, p.y);
+
+                        //the handler of a panel child may have changed the screen (_controls[i] cleared), like a top-level one
+                        if (control->getType() == PANEL && ((Panel *)control)->_clicked)
+                        {
+                            ((Panel *)control)->_clicked = false;
+                            return false;
+                        }
 
-                        priorizedControl = i;                        
+                        priorizedControl = i;
+                        if (touched)
+                            _controls[i]->_dirty = true;
                     }
                 }
             }
@@ -121,37 +268,178 @@ public:
             {
                 if (_controls[i]->getType() != UNDEFINED)
                 {
+                    bool wasTouched = _controls[i]->_isTouched;
+
                     if (_controls[i]->checkTouched(p.x, p.y, p.z) && priorizedControl == -1)
                     {
                         lastTouchedType = _controls[i]->getType();
 
                         _controls[i]->internalOnClickHandler(p.x, p.y);
+                        _controls[i]->_dirty = true;
 
                         if (_controls[i]->clickHandler != nullptr)
                         {
                             _controls[i]->clickHandler();
-                            return;
+                            return false;
                         }
                     }
 
-                    _controls[i]->draw(_tft);
+                    if (_controls[i]->_isTouched != wasTouched)
+                        _controls[i]->_dirty = true;
                 }
             }
         }
 
-        //draw priorizedControl ovarlay
-        if (priorizedControl >= 0)
+        //take over bound values, all writes since the last update count as one change
+        for (uint8_t i = 0; i < MAXCONTROLS; i++)
         {
-            _controls[priorizedControl]->draw(_tft);
+            if (_controls[i] != nullptr && _controls[i]->getType() != UNDEFINED)
+            {
+                _controls[i]->refresh();
+                if (_controls[i]->enabled != _controls[i]->_drawnEnabled)
+                    _controls[i]->_dirty = true;
+            }
         }
 
-        _tft->updateScreen();
-    };
+        return true;
+    }
+
+    //second half of update(): draws the changed controls or the whole screen and sends the frame
+    void render()
+    {
+#ifdef NOFRAMEBUFFER
+        fitPaletteFrame();
+#endif
+        bool redraw = _redraw || !redrawOnChange;
+
+        for (uint8_t i = 0; i < MAXCONTROLS && !redraw; i++)
+        {
+            if (_controls[i] != nullptr && _controls[i]->getType() != UNDEFINED && _controls[i]->_dirty)
+                redraw = true;
+        }
+
+        if (!redraw)
+            return;
+
+#ifdef PIPELINE
+        if (_pipelined)
+        {
+            //recorded here, drawn and sent by the render task
+            _tft->record(&_pipe, waitForRecord, this);
+            drawFrame();
+            _tft->endFrame();
+            return;
+        }
+#endif
+
+        //the framebuffer may still be on its way to the display
+        waitForFlush();
+        drawFrame();
+        profilePause(true);
+        flush();
+        profilePause(false);
+
+#ifdef DRAWPROFILE
+        if (_tft->getProfile() != NULL)
+            _tft->getProfile()->endFrame();
+#endif
+    }
+
+#ifdef NOFRAMEBUFFER
+    //render in bands of bandHeight lines into buffer (display width * bandHeight pixels) and send every band with one writeRect
+    //no flicker and far less SPI transactions than drawing to the display, without RAM for a whole framebuffer
+    //NULL to draw to the display again, false for a band of 0 lines
+    bool setBandBuffer(uint16_t *buffer, uint16_t bandHeight)
+    {
+        if (buffer != NULL && bandHeight == 0)
+            return false;
+
+        _band = buffer;
+        _bandHeight = bandHeight;
+        _redraw = true;
+        return true;
+    }
+
+    //keep the screen as 8 bit palette indices (needs the band buffer), changed lines are sent once per update
+    void setPaletteFrame(PaletteFrame *frame)
+    {
+        _paletteFrame = frame;
+        _redraw = true;
+    }
+#endif
+
+#ifdef FRAMEDIFF
+    //send only the pixels that changed since the last frame instead of the whole framebuffer (see FrameDiff.h)
+    void setFrameDiff(FrameDiff *diff)
+    {
+        waitForFlush();
+        _frameDiff = diff;
+        if (diff != NULL)
+            diff->invalidate();
+    }
+#endif
+
+#ifdef PIPELINE
+    //draw and send the frames in a render task on the other core, while input() runs and the next frame is recorded
+    //records: 1 or more (see FrameRecord.h), NULL to draw in render() again
+    bool enablePipeline(FrameRecord *records, uint8_t count)
+    {
+        for (uint8_t i = 0; records != NULL && i < count; i++)
+        {
+            if (records[i].ops == NULL || records[i].capacity == 0)
+                return false;
+        }
+
+        waitForFlush();
+        _pipelined = false;
+        if (records == NULL || count == 0)
+        {
+            if (_rendering)
+            {
+                __atomic_store_n(&_stopRendering, true, __ATOMIC_RELEASE);
+                _renderTask.join();
+                _rendering = false;
+            }
+            return true;
+        }
+
+        _pipe.begin(records, count);
+        if (!_rendering)
+        {
+            _stopRendering = false;
+            _frameStart = true;
+            if (!_renderTask.start(renderFrames, this))
+                return false;
+            _rendering = true;
+        }
+        _pipelined = true;
+        return true;
+    }
+
+    //the render task draws the records with the threads of renderer (see TileRenderer.h), NULL to replay them alone
+    //the frame is the same, call it again after setRotation()
+    void setTileRenderer(TileRenderer *renderer)
+    {
+        waitForFlush();
+        _tileRenderer = renderer;
+        _frameBuffer = _tft->getFrameBuffer();
+        _frameWidth = _tft->width();
+        _frameHeight = _tft->height();
+    }
+#endif
+
+    //send frames by DMA in the background: input() of the next update runs while the last frame is sent
+    void enableAsyncUpdate(bool enable)
+    {
+        waitForFlush();
+        asyncUpdate = enable;
+    }
 
     void enableDarkmode(bool enable)
     {
         enable ? _bgColor = 0x0000 : _bgColor = 0xFFFF;
         darkMode = enable;
+        _redraw = true;
 
         for (uint8_t i = 0; i < MAXCONTROLS; i++)
         {
@@ -164,6 +452,7 @@ public:
 
     void calibrateTouch()
     {
+        waitForFlush();
         initNewScreen();
         TS_Point p;
         delay(500);
@@ -229,12 +518,120 @@ public:
 
         while (!_ts->touched())
             ;
+
+#ifdef FRAMEDIFF
+        //the display does not show the last frame any more
+        if (_frameDiff != NULL)
+            _frameDiff->invalidate();
+#endif
     }
 
     uint32_t getLastTouch() {
         return lastTouch;
     }
+
+    //draws skipped since the start, of controls off screen or completely below opaque controls
+    uint32_t getSkippedDraws()
+    {
+        return _skippedDraws;
+    }
 private:
+    UpdateQueue _queue;
+    UpdateQueue *_queues[MAXUPDATEQUEUES] = {&_queue};
+
+    //takes over all posted updates at once, before anything is drawn
+    void applyUpdates()
+    {
+        for (uint8_t i = 0; i < MAXUPDATEQUEUES; i++)
+        {
+            if (_queues[i] == nullptr)
+                continue;
+
+            UpdateQueue::message *m;
+            while ((m = _queues[i]->front()) != NULL)
+            {
+                switch (m->kind)
+                {
+                case UpdateQueue::VALUE:
+                    ((Control *)m->target)->applyValue(m->value);
+                    ((Control *)m->target)->_boundValue = NAN;
+                    break;
+                case UpdateQueue::TEXT:
+                    ((Control *)m->target)->applyText(m->text);
+                    break;
+                case UpdateQueue::OBSERVABLE:
+                    ((Observable *)m->target)->set(m->value);
+                    break;
+                }
+                _queues[i]->pop();
+            }
+        }
+    }
+
+    Animation _animations[MAXANIMATIONS];
+    uint8_t _animating = 0;
+
+    Animation *startAnimation(void *target, uint8_t kind, float from, float to, uint32_t ms, uint8_t easing)
+    {
+        Animation *a = NULL;
+        for (uint8_t i = 0; i < MAXANIMATIONS; i++)
+        {
+            if (_animations[i].active && _animations[i].target == target)
+            {
+                a = &_animations[i];
+                break;
+            }
+            if (!_animations[i].active && a == NULL)
+                a = &_animations[i];
+        }
+        if (a == NULL)
+            return NULL;
+
+        if (!a->active)
+            _animating++;
+        a->active = true;
+        a->kind = kind;
+        a->target = target;
+        a->from = from;
+        a->to = to;
+        a->start = millis();
+        a->duration = ms > 0 ? ms : 1;
+        a->easing = easing;
+        return a;
+    }
+
+    //hands the values of all running tweens to their targets, the controls get dirty by applyValue()
+    void animateStep(uint32_t now)
+    {
+        for (uint8_t i = 0; i < MAXANIMATIONS; i++)
+        {
+            Animation &a = _animations[i];
+            if (!a.active)
+                continue;
+
+            float value;
+            if (!a.value(now, value))
+            {
+                a.active = false;
+                _animating--;
+            }
+
+            switch (a.kind)
+            {
+            case Animation::CONTROL:
+                ((Control *)a.target)->applyValue(value);
+                ((Control *)a.target)->_boundValue = NAN;
+                break;
+            case Animation::OBSERVABLE:
+                ((Observable *)a.target)->set(value);
+                break;
+            case Animation::FUNCTION:
+                a.function(value);
+                break;
+            }
+        }
+    }
+
     uint16_t _bgColor = 0xFFFF;
     TFTLIB *_tft;
     XPT2046_Touchscreen *_ts;
@@ -244,4 +641,496 @@ private:
     uint32_t lastTouch = 0;
     uint8_t lastTouchedType = UNDEFINED;
     bool darkMode = false;
-};
\ No newline at end of file
+    bool redrawOnChange = false;
+    bool _redraw = true; // screen, background or theme changed
+    int8_t priorizedControl = -1; // open overlay, drawn last
+    uint32_t _dirtyTiles[TILEROWS];
+    uint16_t _tileSize = TILESIZE;
+    bool asyncUpdate = false;
+    Layout *_layout = NULL;
+    Rect _opaque[MAXCONTROLS]; // areas the controls paint completely, in this frame
+#ifdef FRAMEDIFF
+    FrameDiff *_frameDiff = NULL;
+#endif
+    uint32_t _skippedDraws = 0;
+
+    void drawFrame()
+    {
+        if (!redrawOnChange || _redraw || priorizedControl >= 0)
+            drawScreen();
+        else
+            drawChanges();
+    }
+
+    void drawScreen()
+    {
+        findOpaque();
+
+#ifdef NOFRAMEBUFFER
+        if (_band != NULL)
+        {
+            for (uint8_t i = 0; i < MAXCONTROLS; i++)
+            {
+                if (_controls[i] != nullptr && _controls[i]->getType() != UNDEFINED)
+                    _controls[i]->_drawn = _controls[i]->getBounds(_tft);
+            }
+
+            drawBands({0, 0, _tft->width(), _tft->height()});
+
+            for (uint8_t i = 0; i < MAXCONTROLS; i++)
+            {
+                if (_controls[i] != nullptr && _controls[i]->getType() != UNDEFINED)
+                    drawn(_controls[i]);
+            }
+
+            _redraw = false;
+            return;
+        }
+#endif
+
+        _tft->fillScreen(_bgColor);
+
+        for (uint8_t i = 0; i < MAXCONTROLS; i++)
+        {
+            if (_controls[i] != nullptr)
+            {
+                if (_controls[i]->getType() != UNDEFINED)
+                {
+                    if (visible(i, _controls[i]->getBounds(_tft)))
+                        drawControl(i);
+                    else
+                        _skippedDraws++;
+                    drawn(_controls[i]);
+                }
+            }
+        }
+
+        //draw priorizedControl ovarlay
+        if (priorizedControl >= 0)
+        {
+            drawControl(priorizedControl);
+        }
+
+        _redraw = false;
+    }
+
+    //repaints only the tiles of changed controls, controls that can draw their changes do it on their own
+    void drawChanges()
+    {
+        bool whole[MAXCONTROLS] = {};
+        memset(_dirtyTiles, 0, sizeof(_dirtyTiles));
+        _tileSize = tileSize();
+        findOpaque();
+
+        for (uint8_t i = 0; i < MAXCONTROLS; i++)
+        {
+            Control *c = _controls[i];
+            if (c != nullptr && c->getType() != UNDEFINED && c->_dirty && (!drawsChanges(c) || overlapped(i)))
+            {
+                //old and new area
+                Rect bounds = c->getBounds(_tft);
+                markTiles(c->_drawn.unite(bounds));
+                c->_drawn = bounds;
+                whole[i] = true;
+            }
+        }
+
+        //controls that draw their changes remember what is on the screen, so they are repainted whole or not at all
+        bool grown = true;
+        while (grown)
+        {
+            grown = false;
+            for (uint8_t i = 0; i < MAXCONTROLS; i++)
+            {
+                Control *c = _controls[i];
+                if (c != nullptr && c->getType() != UNDEFINED && !whole[i] && drawsChanges(c) && touchesTiles(c->_drawn))
+                {
+                    markTiles(c->_drawn);
+                    whole[i] = true;
+                    grown = true;
+                }
+            }
+        }
+
+        for (uint8_t i = 0; i < MAXCONTROLS; i++)
+        {
+            Control *c = _controls[i];
+            if (c != nullptr && c->getType() != UNDEFINED && c->_dirty && !whole[i])
+            {
+                c->_dirty = false;
+                if (!visible(i, c->_drawn))
+                {
+                    //repainted whole, when the tiles over it are repainted
+                    _skippedDraws++;
+                    continue;
+                }
+                c->_screenColor = _bgColor;
+                profileOwner(i);
+                c->drawChanges(_tft);
+                profileOwner(PROFILEBACKGROUND);
+            }
+        }
+
+        //dirty tiles, runs of a row merged with the same runs of the rows below
+        for (uint8_t row = 0; row < TILEROWS; row++)
+        {
+            while (_dirtyTiles[row] != 0)
+            {
+                uint8_t first = __builtin_ctz(_dirtyTiles[row]);
+                uint8_t last = first;
+                while (last + 1 < 32 && (_dirtyTiles[row] & (1UL << (last + 1))))
+                    last++;
+
+                uint32_t run = (last - first + 1 < 32 ? (1UL << (last - first + 1)) - 1 : 0xFFFFFFFF) << first;
+                uint8_t rows = 1;
+                while (row + rows < TILEROWS && (_dirtyTiles[row + rows] & run) == run)
+                {
+                    _dirtyTiles[row + rows] &= ~run;
+                    rows++;
+                }
+                _dirtyTiles[row] &= ~run;
+
+                Rect area = {(int16_t)(first * _tileSize), (int16_t)(row * _tileSize), (int16_t)((last - first + 1) * _tileSize), (int16_t)(rows * _tileSize)};
+                drawArea(area);
+            }
+        }
+
+        for (uint8_t i = 0; i < MAXCONTROLS; i++)
+        {
+            if (whole[i])
+                drawn(_controls[i]);
+        }
+    }
+
+    bool drawsChanges(Control *c)
+    {
+#ifdef NOFRAMEBUFFER
+        //changes drawn to the display would be lost with the next send of the palette frame
+        if (_paletteFrame != NULL && _paletteFits)
+            return false;
+#endif
+        return c->canDrawChanges();
+    }
+
+    //background and all controls in area, clipped to it
+    void drawArea(const Rect &area)
+    {
+#ifdef NOFRAMEBUFFER
+        if (_band != NULL)
+        {
+            drawBands(area);
+            return;
+        }
+#endif
+
+        Control::pushClip(_tft, area);
+        _tft->fillRect(area.x, area.y, area.w, area.h, _bgColor);
+
+        for (uint8_t i = 0; i < MAXCONTROLS; i++)
+        {
+            Control *c = _controls[i];
+            if (c != nullptr && c->getType() != UNDEFINED && c->_drawn.intersects(area))
+                drawIn(i, area);
+        }
+
+        Control::popClip(_tft);
+    }
+
+#ifdef NOFRAMEBUFFER
+    uint16_t *_band = NULL;
+    uint16_t _bandHeight = 0;
+    PaletteFrame *_paletteFrame = NULL;
+    bool _paletteFits = false;
+
+    //after setRotation() the palette frame is laid out for the new size and drawn again, if it fits
+    void fitPaletteFrame()
+    {
+        if (_paletteFrame == NULL)
+            return;
+
+        bool fits = _paletteFrame->getWidth() == _tft->width() && _paletteFrame->getHeight() == _tft->height();
+        if (!fits && _paletteFrame->setSize(_tft->width(), _tft->height()))
+        {
+            fits = true;
+            _redraw = true;
+        }
+
+        //too large, the bands go to the display until the size fits again
+        if (fits != _paletteFits)
+            _redraw = true;
+        _paletteFits = fits;
+    }
+
+    //renders area band by band into _band (used as framebuffer for the lines of the band) and sends each band at once
+    void drawBands(const Rect &area)
+    {
+        Rect r = clipToScreen(area);
+        uint16_t width = _tft->width();
+
+        for (int16_t bandY = r.y; bandY < r.y + r.h; bandY += _bandHeight)
+        {
+            int16_t bandH = min((int16_t)_bandHeight, (int16_t)(r.y + r.h - bandY));
+
+            //line bandY is the first line of the band
+            _tft->setFrameBuffer(_band);
+            _tft->useFrameBuffer(true);
+            _tft->setOrigin(0, -bandY);
+            Control::pushClip(_tft, {r.x, bandY, r.w, bandH});
+            _tft->fillRect(r.x, bandY, r.w, bandH, _bgColor);
+
+            Rect band = {r.x, bandY, r.w, bandH};
+            for (uint8_t i = 0; i < MAXCONTROLS; i++)
+            {
+                Control *c = _controls[i];
+                if (c != nullptr && c->getType() != UNDEFINED && c->_drawn.intersects(band))
+                    drawIn(i, band);
+            }
+            if (priorizedControl >= 0)
+                drawControl(priorizedControl);
+
+            Control::popClip(_tft);
+            _tft->setOrigin();
+            _tft->useFrameBuffer(false);
+
+            //lines of the area one after another
+            if (r.w < width)
+            {
+                for (int16_t line = 0; line < bandH; line++)
+                    memmove(_band + line * r.w, _band + line * width + r.x, r.w * sizeof(uint16_t));
+            }
+
+            if (_paletteFrame != NULL && _paletteFits)
+                _paletteFrame->store(_band, r.x, bandY, r.w, bandH);
+            else
+            {
+                profilePause(true);
+                _tft->writeRect(r.x, bandY, r.w, bandH, _band);
+                profilePause(false);
+            }
+        }
+    }
+#endif
+
+    //culling: opaque areas of all controls, before anything is drawn
+    void findOpaque()
+    {
+        for (uint8_t i = 0; i < MAXCONTROLS; i++)
+        {
+            Control *c = _controls[i];
+            if (c != nullptr && c->getType() != UNDEFINED)
+                _opaque[i] = clipToScreen(c->getOpaqueBounds(_tft));
+            else
+                _opaque[i] = {0, 0, 0, 0};
+        }
+    }
+
+    //area of control i on the screen and not painted over by an opaque control drawn after it (or the overlay)
+    bool visible(uint8_t i, const Rect &area)
+    {
+        Rect r = clipToScreen(area);
+        if (r.isEmpty())
+            return false;
+
+        for (uint8_t j = 0; j < MAXCONTROLS; j++)
+        {
+            if (j != i && (j > i || j == priorizedControl) && _opaque[j].contains(r))
+                return false;
+        }
+        return true;
+    }
+
+    //a control drawn after control i is over it, the changes of control i would be drawn over that control
+    //controls erasing with the screen color also need the screen below them, without controls drawn before
+    bool overlapped(uint8_t i)
+    {
+        uint8_t first = _controls[i]->erasesScreen() ? 0 : i + 1;
+        for (uint8_t j = first; j < MAXCONTROLS; j++)
+        {
+            Control *c = _controls[j];
+            if (j != i && c != nullptr && c->getType() != UNDEFINED && c->_drawn.intersects(_controls[i]->_drawn))
+                return true;
+        }
+        return false;
+    }
+
+    //control i, where it is seen in area
+    void drawIn(uint8_t i, const Rect &area)
+    {
+        if (visible(i, _controls[i]->_drawn.intersect(area)))
+            drawControl(i);
+        else
+            _skippedDraws++;
+    }
+
+    void drawControl(uint8_t i)
+    {
+        profileOwner(i);
+        _controls[i]->draw(_tft);
+        profileOwner(PROFILEBACKGROUND);
+    }
+
+    //the pixels drawn from now on are counted for owner (DRAWPROFILE)
+    void profileOwner(uint8_t owner)
+    {
+#ifdef DRAWPROFILE
+        if (_tft->getProfile() != NULL)
+            _tft->getProfile()->setOwner(owner);
+#endif
+    }
+
+    //pixels drawn already (a band, the frame) are sent, the profile does not count them again
+    void profilePause(bool pause)
+    {
+#ifdef DRAWPROFILE
+        if (_tft->getProfile() != NULL)
+            _tft->getProfile()->pause(pause);
+#endif
+    }
+
+    void drawn(Control *control)
+    {
+        control->_dirty = false;
+        control->_drawnEnabled = control->enabled;
+        if (redrawOnChange)
+            control->_drawn = control->getBounds(_tft);
+    }
+
+    //TILESIZE, doubled until the tiles cover the whole display
+    uint16_t tileSize()
+    {
+        uint16_t size = TILESIZE;
+        while ((_tft->width() + size - 1) / size > 32 || (_tft->height() + size - 1) / size > TILEROWS)
+            size *= 2;
+        return size;
+    }
+
+    void markTiles(const Rect &area)
+    {
+        Rect r = clipToScreen(area);
+        if (r.isEmpty())
+            return;
+
+        uint32_t columns = 0;
+        for (uint16_t column = r.x / _tileSize; column <= (r.x + r.w - 1) / _tileSize && column < 32; column++)
+            columns |= 1UL << column;
+        for (uint16_t row = r.y / _tileSize; row <= (r.y + r.h - 1) / _tileSize && row < TILEROWS; row++)
+            _dirtyTiles[row] |= columns;
+    }
+
+    bool touchesTiles(const Rect &area)
+    {
+        Rect r = clipToScreen(area);
+        if (r.isEmpty())
+            return false;
+
+        for (uint16_t row = r.y / _tileSize; row <= (r.y + r.h - 1) / _tileSize && row < TILEROWS; row++)
+            for (uint16_t column = r.x / _tileSize; column <= (r.x + r.w - 1) / _tileSize && column < 32; column++)
+                if (_dirtyTiles[row] & (1UL << column))
+                    return true;
+        return false;
+    }
+
+    Rect clipToScreen(const Rect &area)
+    {
+        int16_t x1 = max(area.x, (int16_t)0);
+        int16_t y1 = max(area.y, (int16_t)0);
+        int16_t x2 = min((int16_t)(area.x + area.w), (int16_t)_tft->width());
+        int16_t y2 = min((int16_t)(area.y + area.h), (int16_t)_tft->height());
+        return {x1, y1, (int16_t)(x2 - x1), (int16_t)(y2 - y1)};
+    }
+
+    void flush()
+    {
+#ifdef FRAMEDIFF
+        if (_frameDiff != NULL)
+        {
+            _frameDiff->send(_tft, _tft->getFrameBuffer());
+            return;
+        }
+#endif
+#ifdef NOFRAMEBUFFER
+        if (_paletteFrame != NULL && _paletteFits && _band != NULL)
+        {
+            _paletteFrame->send(_tft, _band, (uint32_t)_bandHeight * _tft->width());
+            return;
+        }
+#endif
+#ifdef ASYNCUPDATE
+        if (asyncUpdate)
+        {
+            _tft->updateScreenAsync();
+            return;
+        }
+#endif
+        _tft->updateScreen();
+    }
+
+    void waitForFlush()
+    {
+#ifdef PIPELINE
+        //all recorded frames drawn and sent
+        while (_pipelined && !_pipe.empty())
+            Task::pause();
+#endif
+        waitForDisplay();
+    }
+
+    //the last frame sent by DMA
+    void waitForDisplay()
+    {
+#ifdef ASYNCUPDATE
+        if (asyncUpdate)
+            _tft->waitUpdateAsyncComplete();
+#endif
+    }
+
+#ifdef PIPELINE
+    FramePipe _pipe;
+    Task _renderTask;
+    bool _pipelined = false;
+    bool _rendering = false;      // render task started
+    bool _stopRendering = false;
+    bool _frameStart = true;      // render task: the next record starts a frame
+    TileRenderer *_tileRenderer = NULL;
+    uint16_t *_frameBuffer = NULL;
+    int16_t _frameWidth = 0;
+    int16_t _frameHeight = 0;
+
+    //all records handed over, the render task gives one back
+    static void waitForRecord(void *bui)
+    {
+        Task::pause();
+    }
+
+    //render task: draws the handed over records, the frame is sent after its last record
+    static void renderFrames(void *bui)
+    {
+        BUI *ui = (BUI *)bui;
+        while (!__atomic_load_n(&ui->_stopRendering, __ATOMIC_ACQUIRE))
+        {
+            FrameRecord *r = ui->_pipe.front();
+            if (r == NULL)
+            {
+                Task::pause();
+                continue;
+            }
+
+            if (ui->_frameStart)
+                ui->waitForDisplay();
+            if (ui->_tileRenderer != NULL)
+                ui->_tileRenderer->render(r, ui->_frameBuffer, ui->_frameWidth, ui->_frameHeight);
+            else
+                ui->_tft->replay(r);
+            if (r->last)
+                ui->flush();
+            ui->_frameStart = r->last;
+
+            //given back after the send, so an empty pipe is a sent frame
+            ui->_pipe.pop();
+        }
+    }
+#endif
+};
+
+// Screen uses BUI
+#include "ScreenData.h"
@@ -33,6 +33,28 @@
 #error "TFT Library not supported or included after include BUI! Include BUI as last!"
 #endif
 
+#include "FontBits.h"
+#include "DrawProfile.h"
+
+// frames recorded for the render task of BUI (see FrameRecord.h), needs a framebuffer and fonts of the t3 format
+#ifdef PIPELINE
+#define FRAMERECORD
+#endif
+#ifdef FRAMERECORD
+#if defined(NOFRAMEBUFFER) || defined(DRAWPROFILE) || defined(__SSD1351_t3_H_) || defined(__ST7735_t3_H_)
+#error "PIPELINE needs a framebuffer and t3 fonts, without DRAWPROFILE"
+#endif
+#include "FrameRecord.h"
+#endif
+
+// draw through a display list without framebuffer, count the drawn pixels or record frames, the display is declared
+// as DisplayList (see DisplayList.h and DrawProfile.h)
+#if (defined(NOFRAMEBUFFER) && defined(DISPLAYLIST)) || defined(DRAWPROFILE) || defined(FRAMERECORD)
+#include "DisplayList.h"
+#undef TFTLIB
+#define TFTLIB DisplayList
+#endif
+
 // control types
 #define UNDEFINED 0
 #define BUTTON 1
@@ -47,6 +69,50 @@
 #define TEXTBOX 10
 #define NUMPAD 11
 #define BOX 12
+#define LINECHART 13
+#define PANEL 14
+#define STATICGROUP 15
+
+// series per LineChart
+#define LINECHARTSERIES 4
+
+// pixels of the NumPad key atlas (normal and pressed face), keys are made narrower to fit
+// one atlas is shared by all NumPads without setAtlas(), the one drawn last keeps its faces in it
+#ifndef NUMPADATLASPIXELS
+#define NUMPADATLASPIXELS (2 * 56 * 40)
+#endif
+#define NUMPADMAXKEYH 40
+
+// DropDown: options shown at once, margin around an option, cached option widths, ms without touch that end a touch
+#ifndef DROPDOWNROWS
+#define DROPDOWNROWS 8
+#endif
+#define DROPDOWNMARGIN 5
+#define DROPDOWNWIDTHS 16
+#define DROPDOWNRELEASE 100
+
+// children of a Panel, ms without touch that end a touch of a Panel, pixels a finger moves before it scrolls
+#ifndef PANELCHILDREN
+#define PANELCHILDREN 16
+#endif
+#define PANELRELEASE 100
+#define PANELDRAG 8
+
+// nested clip rects (BUI, Panels and controls that clip)
+#ifndef CLIPDEPTH
+#define CLIPDEPTH 8
+#endif
+
+// StaticState flags
+#define STATICDISABLED 0x01
+#define STATICHIDDEN 0x02
+#define STATICDIRTY 0x04 // changed since the last draw
+#define STATICFITTED 0x08 // fitLength and fitW hold the caption of the button
+
+// chars of a TextBox without setBuffer(), kept in str of the control
+#ifndef TEXTBOXLENGTH
+#define TEXTBOXLENGTH 99
+#endif
 
 // aligns
 #define ALIGNLEFT 0
@@ -56,9 +122,69 @@
 #define ALIGNMIDDLE 4
 #define ALIGNBOTTOM 5
 
+#include "ImageData.h"
+#include "TextCache.h"
+#include "NumberFormat.h"
+#include "Observable.h"
+
+// area on the screen
+struct Rect
+{
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+
+    bool isEmpty() const
+    {
+        return w <= 0 || h <= 0;
+    }
+
+    // r lies completely inside
+    bool contains(const Rect &r) const
+    {
+        return !isEmpty() && !r.isEmpty() && r.x >= x && r.y >= y && r.x + r.w <= x + w && r.y + r.h <= y + h;
+    }
+
+    bool intersects(const Rect &r) const
+    {
+        return !isEmpty() && !r.isEmpty() && x < r.x + r.w && r.x < x + w && y < r.y + r.h && r.y < y + h;
+    }
+
+    // area in both, empty if they do not overlap
+    Rect intersect(const Rect &r) const
+    {
+        int16_t x1 = max(x, r.x);
+        int16_t y1 = max(y, r.y);
+        int16_t x2 = min(x + w, r.x + r.w);
+        int16_t y2 = min(y + h, r.y + r.h);
+        if (x2 <= x1 || y2 <= y1)
+            return {x1, y1, 0, 0};
+        return {x1, y1, (int16_t)(x2 - x1), (int16_t)(y2 - y1)};
+    }
+
+    // smallest rect around both
+    Rect unite(const Rect &r) const
+    {
+        if (isEmpty())
+            return r;
+        if (r.isEmpty())
+            return *this;
+
+        int16_t x1 = min(x, r.x);
+        int16_t y1 = min(y, r.y);
+        int16_t x2 = max(x + w, r.x + r.w);
+        int16_t y2 = max(y + h, r.y + r.h);
+        return {x1, y1, (int16_t)(x2 - x1), (int16_t)(y2 - y1)};
+    }
+};
+
 class Control
 {
     friend class BUI;
+    friend class Panel;
+    friend class Layout;
+    friend class StaticGroup;
 
 public:
     uint16_t x = 0;
@@ -66,6 +192,7 @@ public:
     bool enabled = true;
     uint16_t foreColor = 0x0000;
     uint16_t backColor = 0xFFDF;
+    bool opaque = false; // draw() paints every pixel of its bounds, controls completely below it are not drawn
     bool _isTouched = false;
 
     Control(){};
@@ -74,6 +201,7 @@ public:
     {
         x = xPos;
         y = yPos;
+        _dirty = true;
     }
 
     void setOnClickHandler(void (*function)())
@@ -85,28 +213,53 @@ public:
     {
         f = font;
         fH = f.cap_height + 2;
+        _dirty = true;
     };
 
     void setText(char *text)
     {
         t = text;
+        _dirty = true;
     }
 
     void setText(const String &text)
     {
         t = (char *)text.c_str();
+        _dirty = true;
     }
 
     void setText(long text)
     {
-        ltoa(text, str, 10);
+        NumberFormat::formatInt(text, str);
         t = str;
+        _dirty = true;
     }
 
     void setText(float text, uint8_t strLength, uint8_t decimalPlaces)
     {
-        dtostrf(text, strLength, decimalPlaces, str);
+        uint8_t n = NumberFormat::formatFloat(text, decimalPlaces, str, sizeof(str));
+        NumberFormat::padLeft(str, n, strLength < sizeof(str) - 1 ? strLength : sizeof(str) - 1);
         t = str;
+        _dirty = true;
+    }
+
+    // follow value (and write it, if the control is changed by touch)
+    void bind(Observable *value)
+    {
+        _binding = value;
+        _bindingVersion = 0; // apply with the next update
+        _boundValue = NAN;
+    }
+
+    void unbind()
+    {
+        _binding = NULL;
+    }
+
+    // mark for redraw, e.g. after changing public fields like foreColor or checked
+    void invalidate()
+    {
+        _dirty = true;
     }
 
     uint8_t getType()
@@ -125,6 +278,10 @@ protected:
     bool darkMode = false;
     bool priorized = false;
     char str[100];
+    bool _dirty = true; // needs redraw
+    Observable *_binding = NULL;
+    uint32_t _bindingVersion = 0; // version of _binding that is shown
+    float _boundValue = NAN;      // value of _binding that is shown, NAN after other values were applied
 
     bool checkTouched(int touchX, int touchY, int touchZ)
     {
@@ -141,6 +298,7 @@ protected:
     void enableDarkmode(bool enable)
     {
         darkMode = enable;
+        _dirty = true;
 
         if (darkMode)
         {
@@ -156,10 +314,171 @@ protected:
 
     virtual void draw(TFTLIB *tft){}
 
+    // area draw() paints, texts and overhangs included
+    virtual Rect getBounds(TFTLIB *tft)
+    {
+        return {(int16_t)x, (int16_t)y, (int16_t)(w + 1), (int16_t)(h + 1)};
+    }
+
+    // area draw() paints completely
+    virtual Rect getOpaqueBounds(TFTLIB *tft)
+    {
+        return opaque ? getBounds(tft) : Rect{0, 0, 0, 0};
+    }
+
+    Rect _drawn = {0, 0, 0, 0}; // bounds at the last draw
+    bool _drawnEnabled = true;
+    uint16_t _screenColor = 0xFFFF; // screen background behind the control, set by BUI before drawChanges()
+
     virtual void internalOnClickHandler(int touchX, int touchY) {}
 
     virtual void ddClickHandler(int touchX, int touchY) {}
 
+    // incremental redraw: if all changed controls can draw their changes, BUI does not repaint the screen
+    virtual bool canDrawChanges() { return false; }
+
+    virtual void drawChanges(TFTLIB *tft) {}
+
+    // drawChanges() erases with _screenColor, BUI repaints the tiles instead while another control is below
+    virtual bool erasesScreen() { return false; }
+
+    // a Layout changed w or h, caches of the old size are dropped
+    virtual void resized() {}
+
+    // sets the value of the control from its binding, marks it dirty if that changes what is shown
+    virtual void applyValue(float value) {}
+
+    // text posted through an UpdateQueue, copied because the posted one is gone after the update
+    void applyText(const char *text)
+    {
+        strncpy(str, text, sizeof(str) - 1);
+        str[sizeof(str) - 1] = '\0';
+        t = str;
+        _dirty = true;
+    }
+
+    // called by BUI once per frame before drawing, takes over a changed binding
+    virtual void refresh()
+    {
+        if (_binding != NULL && _binding->version() != _bindingVersion)
+        {
+            _bindingVersion = _binding->version();
+            // a value that changed and came back within one frame is not applied again
+            float value = _binding->get();
+            if (value != _boundValue)
+            {
+                _boundValue = value;
+                applyValue(value);
+            }
+        }
+    }
+
+    // writes a value changed by touch to the binding, without getting it back as a change
+    void publish(float value)
+    {
+        if (_binding != NULL)
+        {
+            _binding->set(value);
+            _bindingVersion = _binding->version();
+            _boundValue = value;
+        }
+    }
+
+    struct ClipStack
+    {
+        Rect rects[CLIPDEPTH];
+        uint8_t depth = 0;
+    };
+
+    static ClipStack &clipStack()
+    {
+        static ClipStack stack;
+        return stack;
+    }
+
+    // clips all drawing to area inside the current clip rect, false if nothing of area is visible
+    // every pushClip() needs its popClip(), nested deeper than CLIPDEPTH the clip is not narrowed any further
+    static bool pushClip(TFTLIB *tft, const Rect &area)
+    {
+        ClipStack &stack = clipStack();
+        Rect r = area;
+        if (stack.depth > 0)
+            r = r.intersect(stack.rects[min(stack.depth, (uint8_t)CLIPDEPTH) - 1]);
+        else
+            r = r.intersect({0, 0, (int16_t)tft->width(), (int16_t)tft->height()});
+
+        if (stack.depth < CLIPDEPTH)
+        {
+            stack.rects[stack.depth] = r;
+            tft->setClipRect(r.x, r.y, r.w, r.h);
+        }
+        stack.depth++;
+        return !r.isEmpty();
+    }
+
+    static void popClip(TFTLIB *tft)
+    {
+        ClipStack &stack = clipStack();
+        if (stack.depth == 0)
+            return;
+
+        stack.depth--;
+        if (stack.depth == 0)
+            tft->setClipRect();
+        else if (stack.depth < CLIPDEPTH)
+        {
+            Rect &r = stack.rects[stack.depth - 1];
+            tft->setClipRect(r.x, r.y, r.w, r.h);
+        }
+    }
+
+    // current clip rect, the screen if none is pushed
+    static Rect clipRect(TFTLIB *tft)
+    {
+        ClipStack &stack = clipStack();
+        if (stack.depth == 0)
+            return {0, 0, (int16_t)tft->width(), (int16_t)tft->height()};
+        return stack.rects[min(stack.depth, (uint8_t)CLIPDEPTH) - 1];
+    }
+
+#if TEXTCACHEBYTES > 0
+    static TextCache &textCache()
+    {
+        static TextCache cache;
+        return cache;
+    }
+#endif
+
+    // prints text with its top left at x, y (from the TextCache, if there is one)
+    static void drawText(TFTLIB *tft, const char *text, int16_t x, int16_t y, uint16_t color, const FONTS &font)
+    {
+#if TEXTCACHEBYTES > 0
+        if (textCache().draw(tft, &font, text, x, y, color))
+            return;
+#endif
+        tft->setFont(font);
+        tft->setTextColor(color);
+        tft->setCursor(x, y);
+        tft->print(text);
+    }
+
+    static uint16_t textWidth(TFTLIB *tft, const char *text, const FONTS &font)
+    {
+#if TEXTCACHEBYTES > 0
+        int16_t width = textCache().width(&font, text);
+        if (width >= 0)
+            return width;
+#endif
+        tft->setFont(font);
+        return tft->strPixelLen(text);
+    }
+
+    // area of text printed with its top left at textX, textY
+    static Rect textBounds(TFTLIB *tft, const char *text, int16_t textX, int16_t textY, const FONTS &font)
+    {
+        return {(int16_t)(textX - 2), (int16_t)(textY - 2), (int16_t)(textWidth(tft, text, font) + 4), (int16_t)(font.line_space + 4)};
+    }
+
     static uint16_t colorBrigthness(uint16_t color, int addBrightness)
     {
         uint8_t r, g, b;
@@ -207,6 +526,76 @@ protected:
         g = (color >> 3) & 0x00FC;
         b = (color << 3) & 0x00F8;
     }
+
+    // draws image at x, y, but not more than maxW x maxH pixels of it, every pixel scale x scale
+    static void drawImage(TFTLIB *tft, int16_t x, int16_t y, const ImageData *image, uint16_t maxW = 0xFFFF, uint16_t maxH = 0xFFFF, uint8_t scale = 1, ImageCache *cache = NULL)
+    {
+        // a scaled chunk has to fit into buf
+        if (scale == 0 || scale > IMAGECHUNK)
+            return;
+
+        uint16_t drawW = image->width < maxW ? image->width : maxW;
+        uint16_t drawH = image->height < maxH ? image->height : maxH;
+
+        // raw images in memory go straight to writeRect
+        if (image->format == IMG_RAW && image->source == NULL && scale == 1)
+        {
+            const uint16_t *data = (const uint16_t *)image->data;
+
+            if (drawW == image->width)
+                tft->writeRect(x, y, drawW, drawH, data);
+            else
+                for (uint16_t row = 0; row < drawH; row++)
+                    tft->writeRect(x, y + row, drawW, 1, data + row * image->width);
+            return;
+        }
+
+        ImageDecoder decoder;
+        uint16_t buf[IMAGECHUNK];
+        uint16_t chunk = IMAGECHUNK / scale;
+        uint32_t decoded = 0; // pixels the decoder went through
+        bool started = false;
+
+        for (uint16_t row = 0; row < drawH; row++)
+        {
+            for (uint16_t col = 0; col < drawW; col += chunk)
+            {
+                uint16_t n = drawW - col < chunk ? drawW - col : chunk;
+                uint32_t pixel = (uint32_t)row * image->width + col;
+                uint16_t *pixels = cache != NULL ? cache->find(image, pixel, n) : NULL;
+
+                if (pixels == NULL)
+                {
+                    if (!started)
+                    {
+                        decoder.begin(image);
+                        started = true;
+                    }
+
+                    // hide H image overflow
+                    decoder.skip(pixel - decoded);
+
+                    pixels = cache != NULL ? cache->store(image, pixel, n) : NULL;
+                    if (pixels == NULL)
+                        pixels = buf;
+                    decoder.decode(pixels, n);
+                    decoded = pixel + n;
+                }
+
+                // expand from the back, so no pixel is overwritten before it is read
+                if (scale > 1)
+                {
+                    for (int16_t i = n - 1; i >= 0; i--)
+                        for (uint8_t s = 0; s < scale; s++)
+                            buf[i * scale + s] = pixels[i];
+                    pixels = buf;
+                }
+
+                for (uint8_t s = 0; s < scale; s++)
+                    tft->writeRect(x + col * scale, y + row * scale + s, n * scale, 1, pixels);
+            }
+        }
+    }
 };
 
 class Button : public Control
@@ -230,19 +619,42 @@ public:
 
     void setImage(uint16_t width, uint16_t height, const uint16_t *data)
     {
-        _image = data;
-        _imageW = width;
-        _imageH = height;
+        _rawImage.width = width;
+        _rawImage.height = height;
+        _rawImage.format = IMG_RAW;
+        _rawImage.bpp = 16;
+        _rawImage.palette = NULL;
+        _rawImage.data = data;
+        _rawImage.source = NULL;
+        setImage(&_rawImage);
+    }
+
+    void setImage(const ImageData *image)
+    {
+        _image = image;
+        _imageW = image->width;
+        _imageH = image->height;
+        _dirty = true;
     }
 
     void removeImage()
     {
         _image = NULL;
+        _dirty = true;
     }
 
     uint8_t style = 1;
 
 protected:
+    friend class StaticGroup;
+
+    Rect getBounds(TFTLIB *tft) override
+    {
+        // the caption is shortened to the width, but may be higher than the button
+        Rect r = {(int16_t)x, (int16_t)y, (int16_t)(w + 1), (int16_t)(h + 1)};
+        return r.unite({(int16_t)x, (int16_t)(y + ((h - fH) / 2) - 1), (int16_t)(w + 1), (int16_t)(f.line_space + 4)});
+    }
+
     void draw(TFTLIB *tft) override
     {
         if (darkMode)
@@ -256,23 +668,24 @@ protected:
             myForeColor = foreColor;
         }
 
-        tft->setFont(f);
-        int tXsize = tft->strPixelLen(t);
         int darken = 0;
 
-        // Check if text is to long for Button
-        if (tXsize + 8 + (_image != NULL ? (_imageW / 2) : 0) > w)
+        // Check if text is to long for Button, the part that fits is printed (t is not changed, it may be in flash)
+        // only measured again when the text, the font or the width changed (hashed, the text may change in place)
+        int16_t space = w - 8 - (_image != NULL ? (_imageW / 2) : 0);
+        uint32_t hash = fitHash();
+        if (hash != _fitHash || space != _fitSpace)
+            fit(tft, hash, space);
+
+        char part[sizeof(str)];
+        char *caption = t;
+        if (_fitCut)
         {
-            bool toLong = true;
-            // while text is to long, remove last char from text
-            while (toLong)
-            {
-                t[strlen(t) - 1] = '\0';
-                tXsize = tft->strPixelLen(t);
-                if (tXsize + 8 + (_image != NULL ? (_imageW / 2) : 0) <= w)
-                    toLong = false;
-            }
+            memcpy(part, t, _fitLength);
+            part[_fitLength] = '\0';
+            caption = part;
         }
+        int tXsize = _fitW;
 
         
         if(style == 0) {
@@ -300,57 +713,84 @@ protected:
             tft->drawRoundRect(x, y, w, h, 3, colorBrigthness(myBackColor, -55 + darken));
         }
 
-        // Image
+        // Image (stay in bounds of button)
         if (_image != NULL)
         {
-            for (uint16_t imgY = 0; imgY < _imageH; imgY++)
-            {
-                if (imgY < h - 4) // make shure we are in V bounds of button (hide V image overflow)
-                    for (uint16_t imgX = 0; imgX < _imageW; imgX++)
-                    {
-                        if (imgX < w - 4) // make shure we are in H bounds of button (hide H image overflow)
-                        {
-                            tft->drawPixel(x + 2 + imgX, y + 2 + imgY, _image[imgY * _imageW + imgX]);
-                        }
-                        else
-                            break;
-                    }
-                else
-                    break;
-            }
+            drawImage(tft, x + 2, y + 2, _image, w - 4, h - 4);
         }
 
         // Text
         if (sizeof(t) > 1)
         {
-            tft->setCursor(x + (w / 2) - (tXsize / 2) + (_image != NULL ? (_imageW / 2) : 0), y + ((h - fH) / 2) + 1);
+            uint16_t textColor;
 
             if(style == 0) {
                 if (enabled)
-                    tft->setTextColor(myForeColor);
+                    textColor = myForeColor;
                 else
-                    tft->setTextColor(0xA534);
+                    textColor = 0xA534;
             } else if(style == 1){
                 if (enabled)
-                    tft->setTextColor(0x0000);
+                    textColor = 0x0000;
                 else
-                    tft->setTextColor(0xA534);
+                    textColor = 0xA534;
             } else {
                 if (enabled)
-                    tft->setTextColor(myForeColor);
+                    textColor = myForeColor;
                 else
-                    tft->setTextColor(0xA534);
+                    textColor = 0xA534;
             }
-            tft->print(t);
+            drawText(tft, caption, x + (w / 2) - (tXsize / 2) + (_image != NULL ? (_imageW / 2) : 0), y + ((h - fH) / 2) + 1, textColor, f);
         }
     }
 
 private:
     uint16_t myForeColor = 0x0000;
     uint16_t myBackColor = 0xF79E;
-    const uint16_t *_image = NULL;
+    const ImageData *_image = NULL;
+    ImageData _rawImage;
     uint16_t _imageW;
     uint16_t _imageH;
+    // part of the caption that fits
+    uint32_t _fitHash = 0;
+    int16_t _fitSpace = -1;
+    bool _fitCut = false;
+    uint8_t _fitLength = 0;
+    int16_t _fitW = 0;
+
+    // while text is to long, remove last char from text
+    void fit(TFTLIB *tft, uint32_t hash, int16_t space)
+    {
+        _fitHash = hash;
+        _fitSpace = space;
+        _fitW = textWidth(tft, t, f);
+        _fitCut = _fitW > space;
+        if (!_fitCut)
+            return;
+
+        char part[sizeof(str)];
+        strncpy(part, t, sizeof(part) - 1);
+        part[sizeof(part) - 1] = '\0';
+        uint8_t length = strlen(part);
+        while (length > 0 && _fitW > space)
+        {
+            part[--length] = '\0';
+            _fitW = textWidth(tft, part, f);
+        }
+        _fitLength = length;
+    }
+
+    // FNV-1a of the text and the font
+    uint32_t fitHash()
+    {
+        uint32_t hash = 2166136261UL;
+        for (const char *c = t; *c != '\0'; c++)
+            hash = (hash ^ (uint8_t)*c) * 16777619UL;
+        const uint8_t *font = (const uint8_t *)&f;
+        for (uint8_t i = 0; i < sizeof(FONTS); i++)
+            hash = (hash ^ font[i]) * 16777619UL;
+        return hash;
+    }
 };
 
 class Label : public Control
@@ -372,30 +812,233 @@ public:
     };
 
     uint8_t textAlign = ALIGNLEFT; // horizontal text alignment
+    uint8_t decimals = 0;          // digits after the point of a bound value
+    uint16_t maxWidth = 0;         // text is clipped to maxWidth pixels from x (0 = no limit)
 
 protected:
+    void applyValue(float value) override
+    {
+        NumberFormat::formatFloat(value, decimals, str, sizeof(str));
+        t = str;
+        _dirty = true;
+    }
+
+    Rect getBounds(TFTLIB *tft) override
+    {
+        Rect r = textBounds(tft, t, x, y, f);
+        if (textAlign == ALIGNCENTER)
+            r.x -= (r.w - 4) / 2;
+        else if (textAlign == ALIGNRIGHT)
+            r.x -= r.w - 4;
+        if (maxWidth > 0)
+            r = r.intersect(widthLimit());
+        return r;
+    }
+
+    // area of maxWidth pixels, aligned like the text
+    Rect widthLimit()
+    {
+        int16_t limitX = textAlign == ALIGNCENTER ? x - maxWidth / 2 : (textAlign == ALIGNRIGHT ? x - maxWidth : x);
+        return {limitX, (int16_t)(y - 2), (int16_t)maxWidth, (int16_t)(f.line_space + 4)};
+    }
+
     void draw(TFTLIB *tft) override
     {
-        tft->setFont(f);
-        tft->setTextColor(foreColor);
+        if (maxWidth > 0)
+        {
+            if (pushClip(tft, widthLimit()))
+                drawAligned(tft);
+            popClip(tft);
+        }
+        else
+            drawAligned(tft);
+    }
 
-        uint16_t textWidth = tft->strPixelLen(t);
+    void drawAligned(TFTLIB *tft)
+    {
+        uint16_t tXsize = textAlign == ALIGNLEFT ? 0 : textWidth(tft, t, f);
         switch (textAlign)
         {
         case ALIGNLEFT:
-            tft->setCursor(x, y);
+            drawText(tft, t, x, y, foreColor, f);
             break;
         case ALIGNCENTER:
-            tft->setCursor(x - textWidth / 2, y);
+            drawText(tft, t, x - tXsize / 2, y, foreColor, f);
+            break;
+        case ALIGNRIGHT:
+            drawText(tft, t, x - tXsize, y, foreColor, f);
+            break;
+        default:
+            drawText(tft, t, x, y, foreColor, f);
+        }
+    }
+};
+
+class NumericLabel : public Label
+{
+public:
+    using Control::bind;
+
+    uint8_t scale = 0;    // decimal digits of a bound fixed point integer (12345 with scale 2 is 123.45)
+    uint8_t minWidth = 0; // right aligned with spaces to at least minWidth chars
+    char *unitName = (char *)"\0"; // printed behind the value
+
+    NumericLabel()
+    {
+        t = text;
+    };
+
+    NumericLabel(int xPos, int yPos, const float *value, uint8_t decimalPlaces = 0, FONTS font = Arial_12) : Label(xPos, yPos, text, font)
+    {
+        decimals = decimalPlaces;
+        bind(value);
+    };
+
+    NumericLabel(int xPos, int yPos, const int32_t *value, uint8_t decimalPlaces = 0, FONTS font = Arial_12) : Label(xPos, yPos, text, font)
+    {
+        decimals = decimalPlaces;
+        bind(value);
+    };
+
+    NumericLabel(int xPos, int yPos, const uint32_t *value, uint8_t decimalPlaces = 0, FONTS font = Arial_12) : Label(xPos, yPos, text, font)
+    {
+        decimals = decimalPlaces;
+        bind(value);
+    };
+
+    void bind(const float *value)
+    {
+        _value = value;
+        _valueType = FLOATVALUE;
+        _shownDecimals = -1;
+    }
+
+    void bind(const int32_t *value)
+    {
+        _value = value;
+        _valueType = INTVALUE;
+        _shownDecimals = -1;
+    }
+
+    void bind(const uint32_t *value)
+    {
+        _value = value;
+        _valueType = UINTVALUE;
+        _shownDecimals = -1;
+    }
+
+protected:
+    void applyValue(float value) override
+    {
+        _observed = value;
+        _value = &_observed;
+        _valueType = FLOATVALUE;
+    }
+
+    void refresh() override
+    {
+        Control::refresh();
+        if (format())
+            _dirty = true;
+    }
+
+    void draw(TFTLIB *tft) override
+    {
+        format();
+
+        // the width is only measured again when the text changed
+        if (_textW < 0)
+            _textW = textWidth(tft, text, f);
+
+        switch (textAlign)
+        {
+        case ALIGNCENTER:
+            drawText(tft, text, x - _textW / 2, y, foreColor, f);
             break;
         case ALIGNRIGHT:
-            tft->setCursor(x - textWidth, y);
+            drawText(tft, text, x - _textW, y, foreColor, f);
             break;
         default:
-            tft->setCursor(x, y);
+            drawText(tft, text, x, y, foreColor, f);
         }
+    }
+
+private:
+    enum
+    {
+        FLOATVALUE,
+        INTVALUE,
+        UINTVALUE
+    };
+    const void *_value = NULL;
+    uint8_t _valueType = FLOATVALUE;
+    char text[24] = "";
+    int16_t _textW = -1;
+    uint32_t _shown = 0; // shown digits as fixed point magnitude
+    bool _shownNegative = false;
+    int8_t _shownDecimals = -1;
+    char *_shownUnit = NULL;
+    float _observed = 0; // value of an Observable binding
+
+    // returns true if the text changed
+    bool format()
+    {
+        if (_value == NULL)
+            return false;
+
+        uint32_t magnitude;
+        bool negative = false;
+        uint8_t valueScale = scale < MAXDECIMALS ? scale : MAXDECIMALS;
+        uint8_t decimals = this->decimals < MAXDECIMALS ? this->decimals : MAXDECIMALS;
+
+        switch (_valueType)
+        {
+        case FLOATVALUE:
+        {
+            int32_t fixed;
+            if (!NumberFormat::toFixed(*(const float *)_value, decimals, fixed))
+                fixed = 0;
+            negative = fixed < 0;
+            magnitude = negative ? -(uint32_t)fixed : fixed;
+            valueScale = decimals;
+            break;
+        }
+        case INTVALUE:
+        {
+            int32_t v = *(const int32_t *)_value;
+            negative = v < 0;
+            magnitude = negative ? -(uint32_t)v : v;
+            break;
+        }
+        default:
+            magnitude = *(const uint32_t *)_value;
+        }
+
+        // round to the shown digits, nothing to do if they are the same
+        if (valueScale > decimals)
+        {
+            uint32_t drop = NumberFormat::pow10(valueScale - decimals);
+            uint32_t rest = magnitude % drop;
+            magnitude = magnitude / drop + (rest >= drop / 2 ? 1 : 0);
+            valueScale = decimals;
+        }
+        negative = negative && magnitude != 0;
+
+        if (magnitude == _shown && negative == _shownNegative && decimals == _shownDecimals && unitName == _shownUnit)
+            return false;
 
-        tft->print(t);
+        _shown = magnitude;
+        _shownNegative = negative;
+        _shownDecimals = decimals;
+        _shownUnit = unitName;
+
+        uint8_t n = NumberFormat::formatFixed(magnitude, negative, valueScale, decimals, text, sizeof(text));
+        n = NumberFormat::padLeft(text, n, minWidth < 12 ? minWidth : 12);
+        if (unitName != NULL && n < sizeof(text) - 1)
+            strncpy(text + n, unitName, sizeof(text) - n - 1);
+        text[sizeof(text) - 1] = '\0';
+        _textW = -1;
+        return true;
     }
 };
 
@@ -422,6 +1065,12 @@ public:
     };
 
 protected:
+    Rect getBounds(TFTLIB *tft) override
+    {
+        Rect box = {(int16_t)x, (int16_t)y, 17, 17};
+        return box.unite(textBounds(tft, t, x + 22, y + ((h - fH) / 2) + 1, f));
+    }
+
     void draw(TFTLIB *tft) override
     {
         if (darkMode)
@@ -451,14 +1100,19 @@ protected:
         }
 
         // the label
-        tft->setTextColor(myForeColor);
-        tft->setCursor(x + 22, y + ((h - fH) / 2) + 1);
-        tft->print(t);
+        drawText(tft, t, x + 22, y + ((h - fH) / 2) + 1, myForeColor, f);
+    }
+
+    void applyValue(float value) override
+    {
+        checked = value != 0;
+        _dirty = true;
     }
 
     void internalOnClickHandler(int touchX, int touchY)
     {
         checked = !checked;
+        publish(checked ? 1 : 0);
     }
 
 private:
@@ -493,7 +1147,10 @@ public:
     void setValue(float Value)
     {
         if (Value <= maxValue && Value >= minValue)
+        {
             value = Value;
+            _dirty = true;
+        }
     }
 
     float getValue()
@@ -502,58 +1159,146 @@ public:
     }
 
 protected:
+    Rect getBounds(TFTLIB *tft) override
+    {
+        // track and the knob anywhere on it, it is centered on the end of the track at maxValue
+        Rect track = {(int16_t)x, (int16_t)y, (int16_t)(w + 1), (int16_t)(h + 1)};
+        return track.unite(knobBounds(x + w));
+    }
+
+    void applyValue(float value) override
+    {
+        setValue(value);
+    }
+
     void draw(TFTLIB *tft) override
     {
-        if (darkMode)
-        {
-            myBackColor = 0x6B4D;
-        }
-        else
+        myBackColor = darkMode ? 0x6B4D : backColor;
+
+        drawTrack(tft);
+        _knobDrawnX = knobX();
+        drawKnob(tft, _knobDrawnX);
+
+        _knobDrawn = true;
+        _trackX = x;
+        _trackY = y;
+        _trackW = w;
+        _trackH = h;
+        _trackColor = myBackColor;
+    }
+
+    // only the knob moved or changed its color
+    bool canDrawChanges() override
+    {
+        return _knobDrawn && x == _trackX && y == _trackY && w == _trackW && h == _trackH &&
+               (darkMode ? 0x6B4D : backColor) == _trackColor;
+    }
+
+    bool erasesScreen() override
+    {
+        return true;
+    }
+
+    // puts the track back under the old knob and draws the new one
+    void drawChanges(TFTLIB *tft) override
+    {
+        Rect old = knobBounds(_knobDrawnX);
+        pushClip(tft, old);
+        tft->fillRect(old.x, old.y, old.w, old.h, _screenColor);
+        drawTrack(tft);
+        popClip(tft);
+
+        _knobDrawnX = knobX();
+        drawKnob(tft, _knobDrawnX);
+    }
+
+    void internalOnClickHandler(int touchX, int touchY)
+    {
+        // inverse of the knob position, clamped to the range
+        int32_t span = w - h / 2;
+        int32_t pos = touchX - x - h / 2;
+        if (pos < 0)
+            pos = 0;
+        else if (pos > span)
+            pos = span;
+
+        value = minValue + (maxValue - minValue) * pos / span;
+        publish(value);
+    }
+
+private:
+    float value = 0;
+    uint16_t myBackColor = 0xF79E;
+
+    // knob center relative to x, only computed again when value, range or size change
+    float _knobValue = NAN;
+    float _knobMin = 0;
+    float _knobMax = 0;
+    uint16_t _knobW = 0;
+    uint16_t _knobH = 0;
+    int16_t _knobOffset = 0;
+
+    // state of the last draw
+    bool _knobDrawn = false;
+    int16_t _knobDrawnX = 0;
+    uint16_t _trackX = 0;
+    uint16_t _trackY = 0;
+    uint16_t _trackW = 0;
+    uint16_t _trackH = 0;
+    uint16_t _trackColor = 0;
+
+    int16_t knobX()
+    {
+        if (value != _knobValue || minValue != _knobMin || maxValue != _knobMax || w != _knobW || h != _knobH)
         {
-            myBackColor = backColor;
+            _knobValue = value;
+            _knobMin = minValue;
+            _knobMax = maxValue;
+            _knobW = w;
+            _knobH = h;
+
+            // position in the range as 16 bit fraction
+            float range = maxValue - minValue;
+            float ratio = range > 0 ? (value - minValue) / range : 0;
+            uint32_t fraction = constrain(ratio, 0.0f, 1.0f) * 65536.0f;
+            _knobOffset = h / 2 + ((fraction * (uint32_t)(w - h / 2) + 32768) >> 16);
         }
+        return x + _knobOffset;
+    }
+
+    Rect knobBounds(int16_t knobX)
+    {
+        return {(int16_t)(knobX - h / 2), (int16_t)y, (int16_t)(h / 2 * 2 + 1), (int16_t)(h / 2 * 2 + 1)};
+    }
 
+    void drawTrack(TFTLIB *tft)
+    {
         // bar + outline
         tft->fillRoundRect(x, y + h / 4, w, h / 2, h / 4, colorBrigthness(myBackColor, 0));
         tft->drawRoundRect(x, y + h / 4, w, h / 2, h / 4, colorBrigthness(myBackColor, -55));
+    }
 
+    void drawKnob(TFTLIB *tft, int16_t knobX)
+    {
         if (darkMode)
         {
             // sliding dot
-            if (_isTouched)
-                tft->fillCircle(((w - h / 2) / (maxValue - minValue) * value) + h / 2 + x, y + h / 2, h / 2, colorBrigthness(myBackColor, 40));
-            else
-                tft->fillCircle(((w - h / 2) / (maxValue - minValue) * value) + h / 2 + x, y + h / 2, h / 2, colorBrigthness(myBackColor, 60));
-
+            tft->fillCircle(knobX, y + h / 2, h / 2, colorBrigthness(myBackColor, _isTouched ? 40 : 60));
             // sliding dot inner border
-            tft->drawCircle(((w - h / 2) / (maxValue - minValue) * value) + h / 2 + x, y + h / 2, h / 2 - 1, colorBrigthness(myBackColor, 40));
+            tft->drawCircle(knobX, y + h / 2, h / 2 - 1, colorBrigthness(myBackColor, 40));
             // sliding dot outer border
-            tft->drawCircle(((w - h / 2) / (maxValue - minValue) * value) + h / 2 + x, y + h / 2, h / 2, colorBrigthness(myBackColor, -35));
+            tft->drawCircle(knobX, y + h / 2, h / 2, colorBrigthness(myBackColor, -35));
         }
         else
         {
             // sliding dot
-            if (_isTouched)
-                tft->fillCircle(((w - h / 2) / (maxValue - minValue) * value) + h / 2 + x, y + h / 2, h / 2, colorBrigthness(myBackColor, -21));
-            else
-                tft->fillCircle(((w - h / 2) / (maxValue - minValue) * value) + h / 2 + x, y + h / 2, h / 2, colorBrigthness(myBackColor, -11));
-
+            tft->fillCircle(knobX, y + h / 2, h / 2, colorBrigthness(myBackColor, _isTouched ? -21 : -11));
             // sliding dot inner border
-            tft->drawCircle(((w - h / 2) / (maxValue - minValue) * value) + h / 2 + x, y + h / 2, h / 2 - 1, colorBrigthness(myBackColor, 11));
+            tft->drawCircle(knobX, y + h / 2, h / 2 - 1, colorBrigthness(myBackColor, 11));
             // sliding dot outer border
-            tft->drawCircle(((w - h / 2) / (maxValue - minValue) * value) + h / 2 + x, y + h / 2, h / 2, colorBrigthness(myBackColor, -55));
+            tft->drawCircle(knobX, y + h / 2, h / 2, colorBrigthness(myBackColor, -55));
         }
     }
-
-    void internalOnClickHandler(int touchX, int touchY)
-    {
-        float ptcX = touchX - x;
-        value = (maxValue - minValue) / (float)w * ptcX;
-    }
-
-private:
-    float value = 0;
-    uint16_t myBackColor = 0xF79E;
 };
 
 class NumericUpDown : public Control
@@ -592,7 +1337,10 @@ public:
     void setValue(float Value)
     {
         if (Value <= maxValue && Value >= minValue)
+        {
             value = Value;
+            _dirty = true;
+        }
     }
 
     float getValue()
@@ -601,6 +1349,17 @@ public:
     }
 
 protected:
+    Rect getBounds(TFTLIB *tft) override
+    {
+        Rect r = {(int16_t)x, (int16_t)y, (int16_t)(w + 1), (int16_t)(h + 1)};
+        return r.unite(textBounds(tft, valueText, x + h / 2 - (f.cap_height + 2) / 2, y + ((h - fH) / 2) + 1, f));
+    }
+
+    void applyValue(float value) override
+    {
+        setValue(value);
+    }
+
     void draw(TFTLIB *tft) override
     {
         if (darkMode)
@@ -623,8 +1382,15 @@ protected:
         tft->drawRect(x, y, w, h, colorBrigthness(myBackColor, -55));
         tft->drawRect(x + 1, y + 1, w - 2, h - 2, colorBrigthness(myBackColor, -20));
 
-        // value
-        dtostrf(value, 3, decimalPlaces, valueText);
+        // value (only formatted again if the shown digits change)
+        int32_t fixed = 0;
+        if (!NumberFormat::toFixed(value, decimalPlaces, fixed) || fixed != shownValue || decimalPlaces != shownDecimals)
+        {
+            uint8_t n = NumberFormat::formatFloat(value, decimalPlaces, valueText, sizeof(valueText));
+            NumberFormat::padLeft(valueText, n, 3);
+            shownValue = fixed;
+            shownDecimals = decimalPlaces;
+        }
         tft->setCursor(x + h / 2 - (f.cap_height + 2) / 2, y + ((h - fH) / 2) + 1);
         tft->print(valueText);
         // tft->drawString(valueText, x + 5, y + ((h - fH) / 2) + 1);
@@ -670,12 +1436,15 @@ protected:
                         value = minValue;
                 }
             }
+            publish(value);
         }
     }
 
 private:
     float value = 0;
-    char valueText[7];
+    char valueText[16];
+    int32_t shownValue = 0;
+    int8_t shownDecimals = -1;
     uint16_t myForeColor = 0x0000;
     uint16_t myBackColor = 0xFFDF;
 };
@@ -729,6 +1498,15 @@ public:
             value = maxValue;
         else if (Value < minValue)
             value = minValue;
+
+        // a change by less than a pixel is not drawn
+        if (!_barDrawn || barPixels() != _barPx)
+            _dirty = true;
+    }
+
+    float getValue()
+    {
+        return value;
     }
 
     // Maximum 5 valueColors, but first one is set by init BarGrap (min, barBaseColor)
@@ -741,6 +1519,8 @@ public:
                 valueColors[i].value = value;
                 valueColors[i].color = color;
                 valueColors[i].isSet = true;
+                _barDrawn = false;
+                _dirty = true;
                 return true;
             }
         }
@@ -749,6 +1529,25 @@ public:
     }
 
 protected:
+    Rect getBounds(TFTLIB *tft) override
+    {
+        // right border overhangs by 2, scale values are right aligned to x + 17 (2 pixels margin like textBounds)
+        int16_t left = x;
+        for (uint8_t i = 1; i <= 4; i++)
+        {
+            char buf[12];
+            itoa(scaleValue(i), buf, 10);
+            left = min(left, (int16_t)(x + 15 - textWidth(tft, buf, Arial_10)));
+        }
+        Rect r = {left, (int16_t)y, (int16_t)(x + w + 3 - left), (int16_t)(h + 1)};
+        return r.unite(textBounds(tft, t, x + w / 2 - textWidth(tft, t, Arial_12_Bold) / 2, y, Arial_12_Bold));
+    }
+
+    void applyValue(float value) override
+    {
+        setValue(value);
+    }
+
     void draw(TFTLIB *tft) override
     {
         if (darkMode)
@@ -762,8 +1561,6 @@ protected:
             myForeColor = foreColor;
         }
 
-        float deltaMinMax = abs(maxValue - minValue);
-        float stepWidth = ((float)h - 26.0f) / deltaMinMax;
         int divisors = 4;
 
         tft->drawLine(x + 19, y + 23, x + 21, y + 23, myForeColor);   // left-top-border
@@ -773,49 +1570,62 @@ protected:
         tft->drawLine(x + w, y + 23, x + w + 2, y + 23, myForeColor);   // right-top-border
 
         // Title
-        tft->setTextColor(myForeColor);
-        tft->setFont(Arial_12_Bold);
-        int tXsize = tft->strPixelLen(t);
-        tft->setCursor(x + w / 2 - tXsize / 2, y);
-        tft->print(t);
-
-        // Bar
-        uint16_t barX = x + 23;
-        uint16_t barY = y + (h - 5) + (-1.0f * ((value - minValue) * stepWidth)) - 2;
-        uint16_t barW = w - 24;
-        uint16_t barH = (value - minValue) * stepWidth - 3;
+        int tXsize = textWidth(tft, t, Arial_12_Bold);
+        drawText(tft, t, x + w / 2 - tXsize / 2, y, myForeColor, Arial_12_Bold);
 
         //bg color
         tft->fillRect(x + 22, y + 23, w-22, h-28, 0x39C7); //dark gray
-        //first color
-        tft->fillRect(barX, barY, barW, barH, valueColors[0].color);
-        for (uint8_t i = 1; i < 5; i++)
-        {
-            if (valueColors[i].isSet)
-            {
-                if (value >= valueColors[i].value)
-                {
-                    barY = y + (h - 5) + -1 * ((value - minValue) * stepWidth);                                // 200 + -110 = 90
-                    barH = ((value - minValue) * stepWidth) - ((valueColors[i].value - minValue) * stepWidth); // 110
+        // Bar
+        _barPx = barPixels();
+        fillBar(tft, 0, _barPx);
 
-                    tft->fillRect(barX, barY, barW, barH, valueColors[i].color); // yellow bar
-                }
-            }
-        }
-        
         // Scale values and divisors
+        tft->setTextColor(myForeColor);
         tft->setFont(Arial_10);
         for (int i = 1; i < divisors + 1; i++)
         {
-            int scaleValue = (deltaMinMax / (float)divisors * (float)i) + minValue;
-            char buf[11];
-            itoa(scaleValue, buf, 10);
+            char buf[12];
+            itoa(scaleValue(i), buf, 10);
             tXsize = tft->strPixelLen(buf);
             tft->setCursor(x + 17 - tXsize, y + h - 10 - (i * (h - 28) / (float)divisors));
-            tft->print(scaleValue);
-
-            tft->drawLine(x + 22, y + h - 5 - (i * (h - 28) / (float)divisors), x + 30, y + h - 5 - (i * (h - 28) / (float)divisors), 0x325F); // Y-Divisor
+            tft->print(buf);
         }
+        drawDivisors(tft, y + 23, y + h - 5);
+
+        _barDrawn = true;
+        _barX = x;
+        _barY = y;
+        _barW = w;
+        _barH = h;
+        _barTitle = t;
+        _barForeColor = myForeColor;
+        _barMin = minValue;
+        _barMax = maxValue;
+    }
+
+    // only the bar moved, axes and scale are still on the screen
+    bool canDrawChanges() override
+    {
+        return _barDrawn && _barX == x && _barY == y && _barW == w && _barH == h && _barTitle == t &&
+               _barForeColor == (darkMode ? 0xFFFF : foreColor) && _barMin == minValue && _barMax == maxValue;
+    }
+
+    // fills or erases the rows between the old and the new top of the bar
+    void drawChanges(TFTLIB *tft) override
+    {
+        uint16_t px = barPixels();
+        if (px == _barPx)
+            return;
+
+        int16_t bottom = y + h - 5;
+        if (px > _barPx)
+            fillBar(tft, _barPx, px);
+        else
+            tft->fillRect(x + 23, bottom - _barPx, w - 24, _barPx - px, 0x39C7); //dark gray
+
+        // divisors lie on top of the bar
+        drawDivisors(tft, bottom - max(px, _barPx), bottom - min(px, _barPx));
+        _barPx = px;
     }
 
     void internalOnClickHandler(int touchX, int touchY)
@@ -827,6 +1637,76 @@ private:
     uint16_t myForeColor = 0x0000;
     uint16_t myBackColor = 0xF79E;
     valueColor valueColors[5];
+
+    // state of the last draw, drawChanges() only draws the bar
+    bool _barDrawn = false;
+    uint16_t _barPx = 0; // bar height in pixels
+    uint16_t _barX = 0;
+    uint16_t _barY = 0;
+    uint16_t _barW = 0;
+    uint16_t _barH = 0;
+    char *_barTitle = NULL;
+    uint16_t _barForeColor = 0;
+    float _barMin = 0;
+    float _barMax = 0;
+
+    // bar height of value in pixels, the bar area is h - 28 pixels high
+    uint16_t barPixels(float value)
+    {
+        float range = abs(maxValue - minValue);
+        if (range <= 0)
+            return 0;
+        int32_t px = (value - minValue) * (h - 28) / range + 0.5f;
+        return constrain(px, 0, h - 28);
+    }
+
+    uint16_t barPixels()
+    {
+        return barPixels(value);
+    }
+
+    // value of divisor i (1 to 4), printed left of the axis
+    int scaleValue(uint8_t i)
+    {
+        return abs(maxValue - minValue) / 4.0f * i + minValue;
+    }
+
+    // bar rows from (inclusive) to (exclusive) above the x axis, in the colors of their values
+    void fillBar(TFTLIB *tft, uint16_t from, uint16_t to)
+    {
+        int16_t bottom = y + h - 5;
+        while (from < to)
+        {
+            // color of row from and where the next color starts
+            uint16_t color = valueColors[0].color;
+            uint16_t end = to;
+            for (uint8_t i = 1; i < 5; i++)
+            {
+                if (!valueColors[i].isSet)
+                    continue;
+
+                uint16_t start = barPixels(valueColors[i].value);
+                if (from >= start)
+                    color = valueColors[i].color;
+                else if (start < end)
+                    end = start;
+            }
+
+            tft->fillRect(x + 23, bottom - end, w - 24, end - from, color);
+            from = end;
+        }
+    }
+
+    // divisors with top <= row < bottom
+    void drawDivisors(TFTLIB *tft, int16_t top, int16_t bottom)
+    {
+        for (uint8_t i = 1; i <= 4; i++)
+        {
+            int16_t row = y + h - 5 - i * (h - 28) / 4;
+            if (row >= top && row < bottom)
+                tft->drawLine(x + 22, row, x + 30, row, 0x325F); // Y-Divisor
+        }
+    }
 };
 
 class DonutGraph : public Control
@@ -868,7 +1748,15 @@ public:
     void setValue(float Value)
     {
         if (Value <= maxValue && Value >= minValue)
+        {
             value = Value;
+            _dirty = true;
+        }
+    }
+
+    float getValue()
+    {
+        return value;
     }
 
     // Maximum 5 valueColors, but first one is set by init BarGrap (min, barBaseColor)
@@ -889,6 +1777,20 @@ public:
     }
 
 protected:
+    Rect getBounds(TFTLIB *tft) override
+    {
+        // texts of the scale may overhang on the right
+        int16_t centerX = x + w / 2;
+        Rect r = {(int16_t)x, (int16_t)y, (int16_t)(w + 12), (int16_t)(h + 1)};
+        r = r.unite(textBounds(tft, t, centerX - textWidth(tft, t, Arial_12_Bold) / 2, y + 99, Arial_12_Bold));
+        return r.unite(textBounds(tft, unitName, centerX - textWidth(tft, unitName, Arial_12_Bold) / 2, y + 54, Arial_12_Bold));
+    }
+
+    void applyValue(float value) override
+    {
+        setValue(value);
+    }
+
     void draw(TFTLIB *tft) override
     {
         if (darkMode)
@@ -1002,53 +1904,26 @@ protected:
             tft->fillTriangle(x1, y1, x2, y2, x4, y4, drawinColor);
         }
 
-        // print segment values
-        float valSegment = deltaVal / 8.0f;
-        int tXsize;
-        float segval;
-        bool multipl = false;
+        // print segment values (texts only change with min and max)
+        if (minValue != segMin || maxValue != segMax)
+            formatSegments();
         tft->setTextColor(myForeColor);
         tft->setFont(Arial_11);
-        char str[14];
         // segval 8
-        segval = maxValue;
-        ltoa(segval, str, 10);
-        if (segval > 1000)
-            segval /= 100.0f, multipl = true;
-        tXsize = tft->strPixelLen(str);
-        tft->setCursor(x + 141 - tXsize / 2, y + 87);
-        tft->print(segval, 0);
+        tft->setCursor(x + 141 - tft->strPixelLen(segText[4]) / 2, y + 87);
+        tft->print(segText[4]);
         // segval 6
         tft->setCursor(x + 125, y + 25);
-        segval = valSegment * 6.0f + (float)minValue;
-        ltoa(segval, str, 10);
-        if (multipl)
-            segval /= 100.0f;
-        tft->print(segval, 0);
+        tft->print(segText[3]);
         // segval 4
-        segval = valSegment * 4.0f + (float)minValue;
-        ltoa(segval, str, 10);
-        if (multipl)
-            segval /= 100.0f;
-        tXsize = tft->strPixelLen(str);
-        tft->setCursor(centerX - tXsize / 2, y + 5);
-        tft->print(segval, 0);
+        tft->setCursor(centerX - tft->strPixelLen(segText[2]) / 2, y + 5);
+        tft->print(segText[2]);
         // segval 2
-        segval = valSegment * 2.0f + (float)minValue;
-        ltoa(segval, str, 10);
-        if (multipl)
-            segval /= 100.0f;
-        tXsize = tft->strPixelLen(str);
-        tft->setCursor(x + 33 - tXsize, y + 25);
-        tft->print(segval, 0);
+        tft->setCursor(x + 33 - tft->strPixelLen(segText[1]), y + 25);
+        tft->print(segText[1]);
         // segval 0
-        segval = minValue;
-        ltoa(segval, str, 10);
-        if (multipl && segval != 0)
-            segval /= 100.0f;
-        tXsize = tft->strPixelLen(str);
-        tft->setCursor(x + 16 - tXsize / 2, y + 87);
-        tft->print(segval, 0);
+        tft->setCursor(x + 16 - tft->strPixelLen(segText[0]) / 2, y + 87);
+        tft->print(segText[0]);
         // print multiplier
         if (multipl)
         {
@@ -1057,26 +1932,24 @@ protected:
         }
 
         // print value
-        ltoa(value, str, 10);
+        if ((int32_t)value != shownValue || valueText[0] == '\0')
+        {
+            shownValue = value;
+            NumberFormat::formatInt(shownValue, valueText);
+        }
         tft->setFont(Arial_20);
-        int tXPos = centerX - tft->strPixelLen(str) / 2;
+        int tXPos = centerX - tft->strPixelLen(valueText) / 2;
         tft->setTextColor(drawinColor);
         tft->setCursor(tXPos, centerY - Arial_20.cap_height / 2);
-        tft->print(str);
+        tft->print(valueText);
 
         // print text
-        tft->setTextColor(myForeColor);
-        tft->setFont(Arial_12_Bold);
-        tXPos = centerX - tft->strPixelLen(t) / 2;
-        tft->setCursor(tXPos, centerY + 17);
-        tft->print(t);
+        tXPos = centerX - textWidth(tft, t, Arial_12_Bold) / 2;
+        drawText(tft, t, tXPos, centerY + 17, myForeColor, Arial_12_Bold);
 
         // print unit name
-        tft->setTextColor(myForeColor);
-        tft->setFont(Arial_12_Bold);
-        tXPos = centerX - tft->strPixelLen(unitName) / 2;
-        tft->setCursor(tXPos, centerY - 28);
-        tft->print(unitName);
+        tXPos = centerX - textWidth(tft, unitName, Arial_12_Bold) / 2;
+        drawText(tft, unitName, tXPos, centerY - 28, myForeColor, Arial_12_Bold);
 
         // graph
         //  tft->fillRect(x + 25, y + (h - 5) + -1 * ((value - minValue) * stepWidth), w - 25, (value - minValue) * stepWidth, valueColors[0].color);
@@ -1100,6 +1973,30 @@ private:
     uint16_t myForeColor = 0x0000;
     uint16_t myBackColor = 0xF79E;
     valueColor valueColors[5];
+    char segText[5][12] = {};
+    float segMin = 0;
+    float segMax = 0;
+    bool multipl = false;
+    char valueText[12] = "";
+    int32_t shownValue = 0;
+
+    // texts of the scale at 0, 2, 4, 6 and 8 eighths, values over 1000 are shown x100
+    void formatSegments()
+    {
+        float valSegment = abs(maxValue - minValue) / 8.0f;
+
+        segMin = minValue;
+        segMax = maxValue;
+        multipl = maxValue > 1000;
+
+        for (uint8_t i = 0; i < 5; i++)
+        {
+            float segval = i < 4 ? valSegment * (i * 2) + minValue : maxValue;
+            if (multipl && (i > 0 || segval != 0))
+                segval /= 100.0f;
+            NumberFormat::formatFloat(segval, 0, segText[i], sizeof(segText[i]));
+        }
+    }
 
     void getCircleCoord(int centerX, int centerY, int radius, float angle, int &outX, int &outY)
     {
@@ -1108,119 +2005,453 @@ private:
     }
 };
 
-class Image : public Control
+class LineChart : public Control
 {
 public:
-    Image()
+    float minValue = 0; // range if autoRange is off
+    float maxValue = 100;
+    bool autoRange = true;     // range from the samples, axes are only redrawn when it changes
+    uint16_t plotColor = 0x39C7; // dark gray
+    uint16_t gridColor = 0x4A69;
+
+    LineChart()
     {
-        type = IMAGE;
+        type = LINECHART;
     };
 
-    Image(int xPos, int yPos, int width, int height, const uint16_t *data)
+    // buffer holds the last capacity samples of the first series
+    LineChart(int xPos, int yPos, int width, int height, float *buffer, uint16_t capacity, uint16_t color, char *title = (char *)"\0", void (*function)() = nullptr)
     {
         x = xPos;
         y = yPos;
-        w = width;
-        h = height;
-        _data = data;
-        type = IMAGE;
+        w = width >= 80 ? width : 80;
+        h = height >= 60 ? height : 60;
+        t = title;
+        clickHandler = function;
+        type = LINECHART;
+        _capacity = capacity;
+        addSeries(buffer, color);
     };
 
-    uint8_t imageHAlign = ALIGNLEFT; // horizontal image alignment
-    uint8_t imageVAlign = ALIGNTOP;  // vertical image alignment
-    bool visible = true;
-    const uint16_t *_data = NULL;
-    uint8_t scale = 1;
-
-protected:
-    void draw(TFTLIB *tft) override
+    // more series with their own buffers of the same capacity
+    bool addSeries(float *buffer, uint16_t color)
     {
-        uint16_t _x = x;
-        uint16_t _y = y;
+        if (_seriesCount >= LINECHARTSERIES)
+            return false;
 
-        switch (imageHAlign)
-        {
-        case ALIGNLEFT:
-            _x = x;
-            break;
-        case ALIGNCENTER:
-            _x = x - w / 2;
-            break;
-        case ALIGNRIGHT:
-            _x = x - w;
-            break;
-        default:
-            _x = x;
-        }
+        _series[_seriesCount].buffer = buffer;
+        _series[_seriesCount].color = color;
+        for (uint32_t n = _total - _count; n < _total; n++)
+            buffer[n % _capacity] = NAN;
+        _seriesCount++;
+        _rescale = true;
+        _dirty = true;
+        return true;
+    }
 
-        switch (imageVAlign)
-        {
-        case ALIGNTOP:
-            _y = y;
-            break;
-        case ALIGNMIDDLE:
-            _y = y - h / 2;
-            break;
-        case ALIGNBOTTOM:
-            _y = y - h;
-            break;
-        default:
-            _y = y;
-        }
+    // sample of the first series (other series get a gap)
+    void addSample(float value)
+    {
+        float values[LINECHARTSERIES];
+        values[0] = value;
+        for (uint8_t s = 1; s < LINECHARTSERIES; s++)
+            values[s] = NAN;
+        addSamples(values);
+    }
 
-        if (visible)
+    // one sample per series
+    void addSamples(const float *values)
+    {
+        uint16_t i = _total % _capacity;
+        for (uint8_t s = 0; s < _seriesCount; s++)
         {
-            if (scale == 1)
-                tft->writeRect(_x, _y, w, h, _data);
-            else
-            {
-                for (uint16_t sY = 0; sY < h * scale; sY++)
-                {
-                    for (uint16_t sX = 0; sX < w * scale; sX++)
-                    {
-                        uint16_t index = sY / scale * w + sX / scale;
-                        tft->drawPixel(sX, sY, _data[index]);
-                    }
-                }
-            }
+            // min and max only have to be searched again if one of them leaves the buffer
+            float old = _series[s].buffer[i];
+            if (_count == _capacity && (old <= _dataMin || old >= _dataMax))
+                _dataStale = true;
+
+            _series[s].buffer[i] = values[s];
+            if (values[s] < _dataMin)
+                _dataMin = values[s];
+            if (values[s] > _dataMax)
+                _dataMax = values[s];
         }
+
+        _total++;
+        if (_count < _capacity)
+            _count++;
+        _dirty = true;
     }
 
-private:
-};
+    void clear()
+    {
+        _total = 0;
+        _count = 0;
+        _dataMin = INFINITY;
+        _dataMax = -INFINITY;
+        _dataStale = false;
+        _rescale = true;
+        _dirty = true;
+    }
 
-class Box : public Control
-{
-public:
-    Box()
+protected:
+    Rect getBounds(TFTLIB *tft) override
     {
-        type = BOX;
-    };
+        Rect r = {(int16_t)(x - 8), (int16_t)y, (int16_t)(w + 9), (int16_t)(h + 1)};
+        if (t[0] == '\0')
+            return r;
+        return r.unite(textBounds(tft, t, x + 32 + (w - 33) / 2 - textWidth(tft, t, Arial_12_Bold) / 2, y, Arial_12_Bold));
+    }
 
-    Box(int xPos, int yPos, int width, int height, uint16_t color)
+    void draw(TFTLIB *tft) override
     {
-        x = xPos;
-        y = yPos;
-        w = width;
-        h = height;
-        myBackColor = color;
-        type = BOX;
-    };
+        if (darkMode)
+            myForeColor = 0xFFFF;
+        else
+            myForeColor = foreColor;
 
-    uint8_t imageHAlign = ALIGNLEFT; // horizontal image alignment
-    uint8_t imageVAlign = ALIGNTOP;  // vertical image alignment
-    bool visible = true;
+        uint8_t titleH = t[0] != '\0' ? 18 : 2;
+        _plotX = x + 32;
+        _plotY = y + titleH;
+        _plotW = w - 33;
+        _plotH = h - titleH - 1;
+        // with more samples than pixels one column shows min and max of several samples
+        _perColumn = (_capacity + _plotW - 1) / _plotW;
 
-protected:
-    void draw(TFTLIB *tft) override
-    {        
-        uint16_t _x = x;
-        uint16_t _y = y;
+        range(_rangeMin, _rangeMax, _decimals);
 
-        switch (imageHAlign)
+        // title
+        if (titleH > 2)
+            drawText(tft, t, x + 32 + _plotW / 2 - textWidth(tft, t, Arial_12_Bold) / 2, y, myForeColor, Arial_12_Bold);
+
+        // frame
+        tft->drawRect(_plotX - 1, _plotY - 1, _plotW + 2, _plotH + 2, myForeColor);
+
+        // scale values
+        tft->setTextColor(myForeColor);
+        tft->setFont(Arial_10);
+        for (uint8_t i = 0; i <= 4; i++)
         {
-        case ALIGNLEFT:
-            _x = x;
+            char buf[16];
+            NumberFormat::formatFloat(_rangeMax - (_rangeMax - _rangeMin) * i / 4.0f, _decimals, buf, sizeof(buf));
+            int16_t textY = gridY(i) - 4;
+            if (textY < _plotY)
+                textY = _plotY;
+            if (textY > _plotY + _plotH - 9)
+                textY = _plotY + _plotH - 9;
+            tft->setCursor(_plotX - 4 - tft->strPixelLen(buf), textY);
+            tft->print(buf);
+        }
+
+        drawPlot(tft);
+        _rescale = false;
+        _drawn = true;
+    }
+
+    bool canDrawChanges() override
+    {
+#ifdef NOFRAMEBUFFER
+        // no framebuffer to scroll, BUI repaints the chart (band by band with setBandBuffer)
+        return false;
+#else
+        // new axes if the samples changed the range
+        if (_drawn && !_rescale && autoRange && _total != _drawnTotal)
+        {
+            float rangeMin, rangeMax;
+            uint8_t decimals;
+            range(rangeMin, rangeMax, decimals);
+            _rescale = rangeMin != _rangeMin || rangeMax != _rangeMax;
+        }
+
+        return _drawn && !_rescale;
+#endif
+    }
+
+    void resized() override
+    {
+        _rescale = true;
+    }
+
+    // scrolls the plot by the new columns and draws only them
+    void drawChanges(TFTLIB *tft) override
+    {
+        if (_total == _drawnTotal)
+            return;
+
+#ifndef NOFRAMEBUFFER
+        uint32_t newest = (_total - 1) / _perColumn;
+        uint32_t shift = _drawnTotal > 0 ? newest - _drawnColumn : _plotW;
+
+        uint16_t *fb = tft->getFrameBuffer();
+        if (fb == NULL || shift >= _plotW || _plotX + _plotW > tft->width() || _plotY + _plotH > tft->height())
+        {
+            drawPlot(tft);
+            return;
+        }
+
+        // move the plot left by shift columns
+        uint16_t stride = tft->width();
+        for (uint16_t row = 0; row < _plotH; row++)
+        {
+            uint16_t *line = fb + (uint32_t)(_plotY + row) * stride + _plotX;
+            memmove(line, line + shift, (_plotW - shift) * sizeof(uint16_t));
+        }
+
+        // columns of samples that left the buffer
+        uint32_t oldest = (_total - _count) / _perColumn;
+        uint32_t first = newest >= (uint32_t)(_plotW - 1) ? newest - (_plotW - 1) : 0;
+        for (uint32_t column = _drawnOldest > first ? _drawnOldest : first; column <= oldest && column < newest; column++)
+            drawColumn(tft, column, newest);
+
+        // the last drawn column (possibly only partly filled before) and the new ones
+        for (uint32_t column = newest - shift; column <= newest; column++)
+            drawColumn(tft, column, newest);
+
+        _drawnColumn = newest;
+        _drawnTotal = _total;
+        _drawnOldest = oldest;
+#endif
+    }
+
+    void internalOnClickHandler(int touchX, int touchY)
+    {
+    }
+
+private:
+    struct series
+    {
+        float *buffer;
+        uint16_t color;
+    };
+
+    series _series[LINECHARTSERIES];
+    uint8_t _seriesCount = 0;
+    uint16_t _capacity = 1;
+    uint16_t _count = 0;  // samples in the buffers
+    uint32_t _total = 0;  // samples ever added, the newest one is _total - 1
+    uint16_t _perColumn = 1;
+    uint16_t _plotX = 0;
+    uint16_t _plotY = 0;
+    uint16_t _plotW = 1;
+    uint16_t _plotH = 1;
+    float _dataMin = INFINITY; // of all samples in the buffers
+    float _dataMax = -INFINITY;
+    bool _dataStale = false;
+    float _rangeMin = 0;
+    float _rangeMax = 0;
+    uint8_t _decimals = 0;
+    bool _rescale = true;
+    bool _drawn = false;
+    uint32_t _drawnTotal = 0;
+    uint32_t _drawnColumn = 0;
+    uint32_t _drawnOldest = 0;
+    uint16_t myForeColor = 0x0000;
+
+    int16_t gridY(uint8_t i)
+    {
+        return _plotY + (_plotH - 1) * i / 4;
+    }
+
+    int16_t valueY(float value)
+    {
+        float pos = (value - _rangeMin) / (_rangeMax - _rangeMin);
+        if (pos < 0)
+            pos = 0;
+        if (pos > 1)
+            pos = 1;
+        return _plotY + _plotH - 1 - (int16_t)(pos * (_plotH - 1) + 0.5f);
+    }
+
+    // background, grid and all visible columns
+    void drawPlot(TFTLIB *tft)
+    {
+        tft->fillRect(_plotX, _plotY, _plotW, _plotH, plotColor);
+        for (uint8_t i = 1; i < 4; i++)
+            tft->drawFastHLine(_plotX, gridY(i), _plotW, gridColor);
+
+        uint32_t newest = _total > 0 ? (_total - 1) / _perColumn : 0;
+        uint32_t oldest = (_total - _count) / _perColumn;
+        uint32_t first = newest >= (uint32_t)(_plotW - 1) ? newest - (_plotW - 1) : 0;
+
+        if (_total > 0)
+            for (uint32_t column = first > oldest ? first : oldest; column <= newest; column++)
+                drawSamples(tft, column, newest);
+
+        _drawnColumn = newest;
+        _drawnTotal = _total;
+        _drawnOldest = oldest;
+    }
+
+    // background, grid and samples of one column
+    void drawColumn(TFTLIB *tft, uint32_t column, uint32_t newest)
+    {
+        int16_t colX = _plotX + _plotW - 1 - (newest - column);
+        tft->drawFastVLine(colX, _plotY, _plotH, plotColor);
+        for (uint8_t i = 1; i < 4; i++)
+            tft->drawPixel(colX, gridY(i), gridColor);
+        drawSamples(tft, column, newest);
+    }
+
+    // line from min to max of the samples in a column, joined to the last sample of the column before
+    void drawSamples(TFTLIB *tft, uint32_t column, uint32_t newest)
+    {
+        int16_t colX = _plotX + _plotW - 1 - (newest - column);
+        uint32_t oldest = _total - _count;
+        uint32_t from = column * _perColumn;
+        uint32_t to = from + _perColumn;
+        if (from > oldest)
+            from--;
+        if (from < oldest)
+            from = oldest;
+        if (to > _total)
+            to = _total;
+
+        for (uint8_t s = 0; s < _seriesCount; s++)
+        {
+            float lo = INFINITY;
+            float hi = -INFINITY;
+            for (uint32_t n = from; n < to; n++)
+            {
+                float v = _series[s].buffer[n % _capacity];
+                if (v < lo)
+                    lo = v;
+                if (v > hi)
+                    hi = v;
+            }
+            if (lo > hi)
+                continue; // only gaps
+
+            int16_t top = valueY(hi);
+            tft->drawFastVLine(colX, top, valueY(lo) - top + 1, _series[s].color);
+        }
+    }
+
+    // nice axis range in 4 steps of 1, 2 or 5 * 10^n around the samples
+    void range(float &rangeMin, float &rangeMax, uint8_t &decimals)
+    {
+        if (!autoRange)
+        {
+            rangeMin = minValue;
+            rangeMax = maxValue;
+            decimals = 1;
+            return;
+        }
+
+        if (_dataStale)
+        {
+            _dataMin = INFINITY;
+            _dataMax = -INFINITY;
+            for (uint8_t s = 0; s < _seriesCount; s++)
+            {
+                for (uint32_t n = _total - _count; n < _total; n++)
+                {
+                    float v = _series[s].buffer[n % _capacity];
+                    if (v < _dataMin)
+                        _dataMin = v;
+                    if (v > _dataMax)
+                        _dataMax = v;
+                }
+            }
+            _dataStale = false;
+        }
+
+        float lo = _dataMin;
+        float hi = _dataMax;
+        if (lo > hi)
+        {
+            lo = 0;
+            hi = 1;
+        }
+        if (hi - lo < 0.001f)
+        {
+            lo -= 0.5f;
+            hi += 0.5f;
+        }
+
+        float magnitude = powf(10.0f, floorf(log10f((hi - lo) / 4.0f)));
+        static const float steps[] = {1, 2, 5, 10, 20};
+        float step = magnitude;
+        for (uint8_t i = 0; i < 5; i++)
+        {
+            step = steps[i] * magnitude;
+            if (floorf(lo / step) * step + 4 * step >= hi)
+                break;
+        }
+
+        rangeMin = floorf(lo / step) * step;
+        rangeMax = rangeMin + 4 * step;
+        decimals = step >= 1 ? 0 : (step >= 0.1f ? 1 : (step >= 0.01f ? 2 : 3));
+    }
+};
+
+class Image : public Control
+{
+public:
+    Image()
+    {
+        type = IMAGE;
+        opaque = true;
+    };
+
+    Image(int xPos, int yPos, int width, int height, const uint16_t *data)
+    {
+        x = xPos;
+        y = yPos;
+        w = width;
+        h = height;
+        _data = data;
+        type = IMAGE;
+        opaque = true;
+    };
+
+    Image(int xPos, int yPos, const ImageData *image)
+    {
+        x = xPos;
+        y = yPos;
+        setImage(image);
+        type = IMAGE;
+        opaque = true;
+    };
+
+    void setImage(const ImageData *image)
+    {
+        _image = image;
+        w = image->width;
+        h = image->height;
+        _dirty = true;
+    }
+
+    // keep decoded tiles of the image in cache (for images read from files)
+    void setCache(ImageCache *cache)
+    {
+        _cache = cache;
+    }
+
+    uint8_t imageHAlign = ALIGNLEFT; // horizontal image alignment
+    uint8_t imageVAlign = ALIGNTOP;  // vertical image alignment
+    bool visible = true;
+    const uint16_t *_data = NULL;
+    uint8_t scale = 1;
+
+protected:
+    Rect getBounds(TFTLIB *tft) override
+    {
+        if (!visible)
+            return {0, 0, 0, 0};
+        int16_t _x = imageHAlign == ALIGNCENTER ? x - w / 2 : (imageHAlign == ALIGNRIGHT ? x - w : x);
+        int16_t _y = imageVAlign == ALIGNMIDDLE ? y - h / 2 : (imageVAlign == ALIGNBOTTOM ? y - h : y);
+        return {_x, _y, (int16_t)(w * scale), (int16_t)(h * scale)};
+    }
+
+    void draw(TFTLIB *tft) override
+    {
+        uint16_t _x = x;
+        uint16_t _y = y;
+
+        switch (imageHAlign)
+        {
+        case ALIGNLEFT:
+            _x = x;
             break;
         case ALIGNCENTER:
             _x = x - w / 2;
@@ -1232,29 +2463,718 @@ protected:
             _x = x;
         }
 
-        switch (imageVAlign)
+        switch (imageVAlign)
+        {
+        case ALIGNTOP:
+            _y = y;
+            break;
+        case ALIGNMIDDLE:
+            _y = y - h / 2;
+            break;
+        case ALIGNBOTTOM:
+            _y = y - h;
+            break;
+        default:
+            _y = y;
+        }
+
+        if (visible)
+        {
+            if (_image != NULL)
+                drawImage(tft, _x, _y, _image, w, h, scale, _cache);
+            else if (scale == 1)
+                tft->writeRect(_x, _y, w, h, _data);
+            else
+            {
+                for (uint16_t sY = 0; sY < h * scale; sY++)
+                {
+                    for (uint16_t sX = 0; sX < w * scale; sX++)
+                    {
+                        uint16_t index = sY / scale * w + sX / scale;
+                        tft->drawPixel(_x + sX, _y + sY, _data[index]);
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    const ImageData *_image = NULL;
+    ImageCache *_cache = NULL;
+};
+
+class Box : public Control
+{
+public:
+    Box()
+    {
+        type = BOX;
+        opaque = true;
+    };
+
+    Box(int xPos, int yPos, int width, int height, uint16_t color)
+    {
+        x = xPos;
+        y = yPos;
+        w = width;
+        h = height;
+        myBackColor = color;
+        type = BOX;
+        opaque = true;
+    };
+
+    uint8_t imageHAlign = ALIGNLEFT; // horizontal image alignment
+    uint8_t imageVAlign = ALIGNTOP;  // vertical image alignment
+    bool visible = true;
+
+protected:
+    Rect getBounds(TFTLIB *tft) override
+    {
+        if (!visible)
+            return {0, 0, 0, 0};
+        int16_t _x = imageHAlign == ALIGNCENTER ? x - w / 2 : (imageHAlign == ALIGNRIGHT ? x - w : x);
+        int16_t _y = imageVAlign == ALIGNMIDDLE ? y - h / 2 : (imageVAlign == ALIGNBOTTOM ? y - h : y);
+        return {_x, _y, (int16_t)w, (int16_t)h};
+    }
+
+    void draw(TFTLIB *tft) override
+    {        
+        uint16_t _x = x;
+        uint16_t _y = y;
+
+        switch (imageHAlign)
+        {
+        case ALIGNLEFT:
+            _x = x;
+            break;
+        case ALIGNCENTER:
+            _x = x - w / 2;
+            break;
+        case ALIGNRIGHT:
+            _x = x - w;
+            break;
+        default:
+            _x = x;
+        }
+
+        switch (imageVAlign)
+        {
+        case ALIGNTOP:
+            _y = y;
+            break;
+        case ALIGNMIDDLE:
+            _y = y - h / 2;
+            break;
+        case ALIGNBOTTOM:
+            _y = y - h;
+            break;
+        default:
+            _y = y;
+        }
+
+        if (visible)
+        {
+            tft->fillRect(_x, _y, w, h, myBackColor);
+        }
+    }
+
+private:
+    uint16_t myBackColor = 0xFFDF;
+};
+
+class Panel : public Control
+{
+public:
+    Panel()
+    {
+        type = PANEL;
+        opaque = true;
+    };
+
+    Panel(int xPos, int yPos, int width, int height)
+    {
+        x = xPos;
+        y = yPos;
+        w = width;
+        h = height;
+        type = PANEL;
+        opaque = true;
+    };
+
+    // x and y of control are taken as its position in the content of the panel (0, 0 = top left of the panel)
+    // the panel draws and touches its children, do not add them to BUI as well (no DropDown or NumPad)
+    bool addControl(Control *control)
+    {
+        if (_count >= PANELCHILDREN)
+            return false;
+
+        _children[_count] = control;
+        _childX[_count] = control->x;
+        _childY[_count] = control->y;
+        _top[_count] = control->y;
+        _bottom[_count] = control->y + control->h + 1;
+        _contentH = max(_contentH, _bottom[_count]);
+        control->enableDarkmode(darkMode);
+        _count++;
+        _dirty = true;
+        return true;
+    }
+
+    void clearControls()
+    {
+        _count = 0;
+        _contentH = 0;
+        _scroll = 0;
+        _dirty = true;
+    }
+
+    // pixels the content is scrolled up, kept in the content height
+    void setScroll(int16_t scroll)
+    {
+        scroll = constrain(scroll, 0, max(_contentH - (int16_t)h, 0));
+        if (scroll != _scroll)
+        {
+            _scroll = scroll;
+            _dirty = true;
+        }
+    }
+
+    int16_t getScroll()
+    {
+        return _scroll;
+    }
+
+    int16_t getContentHeight()
+    {
+        return _contentH;
+    }
+
+protected:
+    Rect getBounds(TFTLIB *tft) override
+    {
+        return {(int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h};
+    }
+
+    void draw(TFTLIB *tft) override
+    {
+        uint16_t border = darkMode ? 0x6B4D : colorBrigthness(backColor, -55);
+        tft->fillRect(x, y, w, h, backColor);
+        tft->drawRect(x, y, w, h, border);
+
+        // extents of changed children, the content height follows them
+        for (uint8_t i = 0; i < _count; i++)
+        {
+            if (_children[i]->_dirty)
+                measure(tft, i);
+        }
+        _scroll = constrain(_scroll, 0, max(_contentH - (int16_t)h, 0));
+        place();
+
+        // children outside the view are not drawn at all
+        if (pushClip(tft, view()))
+        {
+            Rect clip = clipRect(tft);
+            for (uint8_t i = 0; i < _count; i++)
+            {
+                Control *c = _children[i];
+                if (c->darkMode != darkMode)
+                    c->enableDarkmode(darkMode);
+
+                int16_t top = y + _top[i] - _scroll;
+                int16_t bottom = y + _bottom[i] - _scroll;
+                if (top < clip.y + clip.h && bottom > clip.y)
+                    c->draw(tft);
+            }
+        }
+        popClip(tft);
+
+        for (uint8_t i = 0; i < _count; i++)
+        {
+            _children[i]->_dirty = false;
+            _children[i]->_drawnEnabled = _children[i]->enabled;
+        }
+
+        // scroll bar
+        if (_contentH > h)
+        {
+            uint16_t barH = max((uint16_t)((uint32_t)h * h / _contentH), (uint16_t)8);
+            uint16_t barY = y + (uint32_t)(h - barH) * _scroll / (_contentH - h);
+            tft->fillRect(x + w - 4, barY, 3, barH, border);
+        }
+    }
+
+    // takes over the bindings of the children, the panel is repainted if one of them changed
+    void refresh() override
+    {
+        Control::refresh();
+        for (uint8_t i = 0; i < _count; i++)
+        {
+            Control *c = _children[i];
+            c->refresh();
+            if (c->_dirty || c->enabled != c->_drawnEnabled)
+                _dirty = true;
+        }
+    }
+
+    // a touch scrolls if the finger moves, else it clicks the child on release; sliders get every sample
+    // the panel is priorized while touched, so BUI calls it without touch (0, 0) as well and the release is seen
+    void internalOnClickHandler(int touchX, int touchY)
+    {
+        uint32_t now = millis();
+        bool sample = (touchX != 0 || touchY != 0) && touchX >= x && touchX <= x + w && touchY >= y && touchY <= y + h;
+
+        if (sample)
+        {
+            if (now - _lastSample > PANELRELEASE)
+            {
+                // new touch
+                place();
+                _touchX = touchX;
+                _touchY = touchY;
+                _touchScroll = _scroll;
+                _dragged = false;
+                _touched = childAt(touchX, touchY);
+                priorized = true;
+            }
+            else if (!_dragged && !touchesSlider() && abs(touchY - _touchY) > PANELDRAG)
+                _dragged = true;
+
+            if (_dragged)
+            {
+                setScroll(_touchScroll + _touchY - touchY);
+                place();
+            }
+            else if (_touched >= 0)
+            {
+                Control *c = _children[_touched];
+                c->_isTouched = true;
+                if (touchesSlider())
+                    c->internalOnClickHandler(touchX, touchY);
+                _dirty = true;
+            }
+            _lastSample = now;
+            return;
+        }
+
+        // released
+        if (_lastSample != 0 && now - _lastSample > PANELRELEASE)
+        {
+            _lastSample = 0;
+            priorized = false;
+            _dirty = true;
+
+            if (_touched >= 0)
+            {
+                Control *c = _children[_touched];
+                c->_isTouched = false;
+                c->_dirty = true;
+
+                if (!_dragged && !touchesSlider())
+                {
+                    c->internalOnClickHandler(_touchX, _touchY);
+                    if (c->clickHandler != nullptr)
+                    {
+                        c->clickHandler();
+                        _clicked = true;
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    friend class BUI;
+
+    Control *_children[PANELCHILDREN];
+    int16_t _childX[PANELCHILDREN]; // position in the content
+    int16_t _childY[PANELCHILDREN];
+    int16_t _top[PANELCHILDREN]; // drawn lines in the content
+    int16_t _bottom[PANELCHILDREN];
+    uint8_t _count = 0;
+    int16_t _contentH = 0;
+    int16_t _scroll = 0;
+
+    // touch
+    uint32_t _lastSample = 0;
+    int16_t _touchX = 0;
+    int16_t _touchY = 0;
+    int16_t _touchScroll = 0;
+    int8_t _touched = -1;
+    bool _dragged = false;
+    bool _clicked = false; // the clickHandler of a child ran, BUI ends input() like for its own controls
+
+    Rect view()
+    {
+        return {(int16_t)(x + 1), (int16_t)(y + 1), (int16_t)(w - 2), (int16_t)(h - 2)};
+    }
+
+    // screen position of the children (above the panel y wraps around, which the drawing functions take as negative)
+    void place()
+    {
+        for (uint8_t i = 0; i < _count; i++)
+        {
+            _children[i]->x = x + _childX[i];
+            _children[i]->y = y + _childY[i] - _scroll;
+        }
+    }
+
+    void measure(TFTLIB *tft, uint8_t i)
+    {
+        _children[i]->x = x + _childX[i];
+        _children[i]->y = y + _childY[i];
+        Rect bounds = _children[i]->getBounds(tft);
+        _top[i] = bounds.y - y;
+        _bottom[i] = bounds.y + bounds.h - y;
+
+        _contentH = 0;
+        for (uint8_t j = 0; j < _count; j++)
+            _contentH = max(_contentH, _bottom[j]);
+    }
+
+    // topmost enabled child at the touch point in the view, -1 if none
+    int8_t childAt(int16_t touchX, int16_t touchY)
+    {
+        Rect v = view();
+        if (touchX < v.x || touchX >= v.x + v.w || touchY < v.y || touchY >= v.y + v.h)
+            return -1;
+
+        for (int8_t i = _count - 1; i >= 0; i--)
+        {
+            Control *c = _children[i];
+            int16_t cx = c->x, cy = c->y;
+            if (c->enabled && touchX >= cx && touchX <= cx + c->w && touchY >= cy && touchY <= cy + c->h)
+                return i;
+        }
+        return -1;
+    }
+
+    bool touchesSlider()
+    {
+        return _touched >= 0 && _children[_touched]->getType() == SLIDER;
+    }
+};
+
+/*
+ * Buttons and labels that do not change much, kept as a const table (flash) and drawn by one control:
+ *
+ *   const StaticControl menu[] PROGMEM = {
+ *       {LABEL, ALIGNLEFT, 10, 10, 0, 0, 0x0000, 0xFFDF, &Arial_16, "Menu", nullptr},
+ *       {BUTTON, 1, 10, 40, 120, 30, 0x0000, 0xFFDF, NULL, "Start", &onStart},
+ *   };
+ *   StaticState menuStates[2];
+ *   StaticGroup menuGroup = StaticGroup(menu, menuStates, 2);
+ *   ui.addControl(&menuGroup);
+ *
+ * An item needs its StaticState in RAM (12 bytes), instead of a Label (188 bytes on Teensy) or a Button (236).
+ * The items are drawn by one Button and one Label shared by all groups, so they look like those controls.
+ */
+struct StaticControl
+{
+    uint8_t type;  // BUTTON or LABEL
+    uint8_t style; // Button: style, Label: textAlign
+    int16_t x;
+    int16_t y;
+    uint16_t w; // Button: size, Label: maxWidth (0 = no limit)
+    uint16_t h;
+    uint16_t foreColor;
+    uint16_t backColor;
+    const FONTS *font; // NULL = default font of the control
+    const char *text;
+    void (*function)(); // called on click, nullptr = not clickable
+};
+
+// the part of an item that changes
+struct StaticState
+{
+    const char *text;  // shown instead of the text of the table, NULL = that one
+    int16_t drawnX;    // columns at the last draw, to clear them after a change (y and h do not change)
+    int16_t drawnW;
+    int16_t fitW;      // width of the fitted caption of a button
+    uint8_t fitLength; // chars of the caption that fit, 255 = all
+    uint8_t flags;
+};
+
+class StaticGroup : public Control
+{
+public:
+    StaticGroup()
+    {
+        type = STATICGROUP;
+    };
+
+    // count items of the table, states is RAM for count StaticStates
+    StaticGroup(const StaticControl *items, StaticState *states, uint8_t count)
+    {
+        _items = items;
+        _states = states;
+        _count = count;
+        memset(states, 0, count * sizeof(StaticState));
+        type = STATICGROUP;
+
+        // touch area until the texts are measured
+        Rect area = {0, 0, 0, 0};
+        for (uint8_t i = 0; i < count; i++)
+            area = area.unite({items[i].x, items[i].y, (int16_t)(items[i].w + 1), (int16_t)(items[i].h + 1)});
+        setArea(area);
+    }
+
+    // shown instead of the text of the table, NULL = that one (text is not copied)
+    // set it again after changing the chars of the text
+    void setItemText(uint8_t index, const char *text)
+    {
+        if (index >= _count)
+            return;
+        _states[index].text = text;
+        _states[index].flags &= ~STATICFITTED;
+        changed(index);
+    }
+
+    const char *getItemText(uint8_t index)
+    {
+        if (index >= _count)
+            return NULL;
+        return _states[index].text != NULL ? _states[index].text : _items[index].text;
+    }
+
+    void setItemEnabled(uint8_t index, bool enable)
+    {
+        setFlag(index, STATICDISABLED, !enable);
+    }
+
+    void setItemVisible(uint8_t index, bool visible)
+    {
+        setFlag(index, STATICHIDDEN, !visible);
+    }
+
+    // last clicked item, for a function shared by items
+    int16_t getClickedItem()
+    {
+        return _clicked;
+    }
+
+protected:
+    Rect getBounds(TFTLIB *tft) override
+    {
+        _tft = tft;
+        Rect r = {0, 0, 0, 0};
+        for (uint8_t i = 0; i < _count; i++)
+        {
+            if (!(_states[i].flags & STATICHIDDEN))
+                r = r.unite(paint(i)->getBounds(tft));
+        }
+        return r;
+    }
+
+    // items in the clip rect
+    void draw(TFTLIB *tft) override
+    {
+        _tft = tft;
+        Rect clip = clipRect(tft);
+        Rect area = {0, 0, 0, 0};
+
+        for (uint8_t i = 0; i < _count; i++)
+        {
+            StaticState &state = _states[i];
+            if (state.flags & STATICHIDDEN)
+            {
+                state.drawnW = 0;
+                continue;
+            }
+
+            Control *p = paint(i);
+            Rect bounds = p->getBounds(tft);
+            if (bounds.intersects(clip))
+            {
+                p->draw(tft);
+                keepFit(i);
+            }
+
+            state.drawnX = bounds.x;
+            state.drawnW = bounds.w;
+            area = area.unite(bounds);
+            if (clip.contains(bounds))
+                state.flags &= ~STATICDIRTY;
+        }
+        setArea(area);
+    }
+
+    // as long as the items stay in the area BUI knows of
+    bool canDrawChanges() override
+    {
+        return _tft != NULL && _drawn.contains(getBounds(_tft));
+    }
+
+    bool erasesScreen() override
+    {
+        return true;
+    }
+
+    // clears the old and new area of the changed items and draws the items there
+    void drawChanges(TFTLIB *tft) override
+    {
+        if (enabled != _drawnEnabled)
+        {
+            for (uint8_t i = 0; i < _count; i++)
+                _states[i].flags |= STATICDIRTY;
+            _drawnEnabled = enabled;
+        }
+
+        Rect damage = {0, 0, 0, 0};
+        for (uint8_t i = 0; i < _count; i++)
+        {
+            StaticState &state = _states[i];
+            if (!(state.flags & STATICDIRTY))
+                continue;
+
+            Rect bounds = paint(i)->getBounds(tft);
+            damage = damage.unite({state.drawnX, bounds.y, state.drawnW, bounds.h});
+            if (!(state.flags & STATICHIDDEN))
+                damage = damage.unite(bounds);
+            state.flags &= ~STATICDIRTY;
+        }
+        if (damage.isEmpty())
+            return;
+
+        if (pushClip(tft, damage))
+        {
+            Rect r = clipRect(tft);
+            tft->fillRect(r.x, r.y, r.w, r.h, _screenColor);
+            draw(tft);
+        }
+        popClip(tft);
+    }
+
+    // the clicked item becomes the click handler, BUI calls it
+    void internalOnClickHandler(int touchX, int touchY) override
+    {
+        _clicked = -1;
+        for (int16_t i = _count - 1; i >= 0 && _clicked < 0; i--)
+        {
+            const StaticControl &item = _items[i];
+            if (item.function == nullptr || (_states[i].flags & (STATICHIDDEN | STATICDISABLED)))
+                continue;
+
+            Rect r = {item.x, item.y, (int16_t)(item.w + 1), (int16_t)(item.h + 1)};
+            if (item.type == LABEL && _tft != NULL)
+                r = paint(i)->getBounds(_tft);
+            if (touchX >= r.x && touchX < r.x + r.w && touchY >= r.y && touchY < r.y + r.h)
+                _clicked = i;
+        }
+        clickHandler = _clicked >= 0 ? _items[_clicked].function : nullptr;
+    }
+
+private:
+    const StaticControl *_items = NULL;
+    StaticState *_states = NULL;
+    uint8_t _count = 0;
+    int16_t _clicked = -1;
+    TFTLIB *_tft = NULL; // to measure the items outside of draw()
+
+    static Button &buttonPainter()
+    {
+        static Button button;
+        return button;
+    }
+
+    static Label &labelPainter()
+    {
+        static Label label;
+        return label;
+    }
+
+    // the shared Button or Label, set up as item i
+    Control *paint(uint8_t i)
+    {
+        const StaticControl &item = _items[i];
+        StaticState &state = _states[i];
+        Control *p;
+
+        if (item.type == BUTTON)
+        {
+            Button &button = buttonPainter();
+            button.style = item.style;
+            p = &button;
+        }
+        else
+        {
+            Label &label = labelPainter();
+            label.textAlign = item.style;
+            label.maxWidth = item.w;
+            p = &label;
+        }
+
+        p->x = item.x;
+        p->y = item.y;
+        p->w = item.w;
+        p->h = item.h;
+        p->t = (char *)(state.text != NULL ? state.text : item.text);
+        if (item.font != NULL)
+            p->setFont(*item.font);
+        else
         {
-        case ALIGNTOP:
-            _y = y;
-            break;
-        case ALIGNMIDDLE:
-            _y = y - h / 2;
-            break;
-        case ALIGNBOTTOM:
-            _y = y - h;
-            break;
-        default:
-            _y = y;
+            // defaults of the constructors
+            p->f = item.type == BUTTON ? Arial_14 : Arial_12;
+            p->fH = 14;
         }
+        p->enableDarkmode(darkMode);
+        if (!darkMode)
+        {
+            p->foreColor = item.foreColor;
+            p->backColor = item.backColor;
+        }
+        p->enabled = enabled && !(state.flags & STATICDISABLED);
 
-        if (visible)
+        // the caption fitted at the first draw of the item, the shared button keeps only the last one
+        if (item.type == BUTTON && (state.flags & STATICFITTED))
         {
-            tft->fillRect(_x, _y, w, h, myBackColor);
+            Button &button = buttonPainter();
+            button._fitHash = button.fitHash();
+            button._fitSpace = button.w - 8;
+            button._fitCut = state.fitLength != 255;
+            button._fitLength = state.fitLength != 255 ? state.fitLength : 0;
+            button._fitW = state.fitW;
         }
+        return p;
     }
 
-private:
-    uint16_t myBackColor = 0xFFDF;
+    // keeps the caption the shared button fitted for item i
+    void keepFit(uint8_t i)
+    {
+        StaticState &state = _states[i];
+        if (_items[i].type != BUTTON || (state.flags & STATICFITTED))
+            return;
+
+        Button &button = buttonPainter();
+        state.fitLength = button._fitCut ? button._fitLength : 255;
+        state.fitW = button._fitW;
+        state.flags |= STATICFITTED;
+    }
+
+    // touch area of BUI
+    void setArea(const Rect &r)
+    {
+        x = r.x;
+        y = r.y;
+        w = r.w > 0 ? r.w - 1 : 0;
+        h = r.h > 0 ? r.h - 1 : 0;
+    }
+
+    void changed(uint8_t index)
+    {
+        _states[index].flags |= STATICDIRTY;
+        _dirty = true;
+    }
+
+    void setFlag(uint8_t index, uint8_t flag, bool set)
+    {
+        if (index >= _count || ((_states[index].flags & flag) != 0) == set)
+            return;
+        if (set)
+            _states[index].flags |= flag;
+        else
+            _states[index].flags &= ~flag;
+        changed(index);
+    }
 };
 
 class DropDown : public Control
@@ -1282,51 +3202,67 @@ public:
         type = DROPDOWN;
     };
 
+    // up to 8 options, use setOptions() for more
     bool addOption(char *text)
     {
-        for (uint8_t i = 0; i < 8; i++)
-        {
-            if (options[i] == NULL || options[i][0] == '\0')
-            {
-                options[i] = text;
-                _optionsCount += 1;
-                return true;
-            }
-        }
+        if (_provider != nullptr || _optionsCount >= 8)
+            return false;
 
-        return false;
+        options[_optionsCount++] = text;
+        _dirty = true;
+        return true;
+    }
+
+    // count options, provider returns the text of option index (only called for the visible ones)
+    void setOptions(uint16_t count, char *(*provider)(uint16_t index))
+    {
+        _provider = provider;
+        _optionsCount = count;
+        _first = 0;
+        if (_selectedIndex >= count)
+            setSelectedIndex(-1);
+        clearWidths();
+        _dirty = true;
     }
 
     char *getSelectedOption()
     {
-        return options[_selectedIndex];
+        return _selectedIndex >= 0 ? str : nullptr;
     }
 
-    int8_t getSelectedIndex()
+    int16_t getSelectedIndex()
     {
         return _selectedIndex;
     }
 
-    bool setSelectedIndex(int8_t index)
+    bool setSelectedIndex(int16_t index)
     {
         if (index == -1)
         {
             _selectedIndex = index;
-            t = '\0';
+            t = (char *)"\0";
+            _dirty = true;
             return true;
         }
 
-        if (options[index] != NULL && options[index][0] != '\0')
-        {
-            _selectedIndex = index;
-            t = options[index];
-            return true;
-        }
-        else
+        if (index < 0 || index >= _optionsCount)
+            return false;
+
+        char *text = option(index);
+        if (text == NULL || text[0] == '\0')
             return false;
+
+        // copied, the provider may return a temporary text
+        _selectedIndex = index;
+        strncpy(str, text, sizeof(str) - 1);
+        str[sizeof(str) - 1] = '\0';
+        t = str;
+        _fitText = NULL;
+        _dirty = true;
+        return true;
     }
 
-    uint8_t getOptionsCount()
+    uint16_t getOptionsCount()
     {
         return _optionsCount;
     }
@@ -1337,6 +3273,26 @@ protected:
     uint16_t ddX = 0;
     uint16_t ddY = 0;
 
+    Rect getBounds(TFTLIB *tft) override
+    {
+        Rect r = {(int16_t)x, (int16_t)y, (int16_t)(w + 1), (int16_t)(h + 1)};
+        if (isOpened)
+        {
+            window(tft);
+            r = r.unite({(int16_t)ddX, (int16_t)ddY, (int16_t)(ddWidth + 1), (int16_t)(ddHeight + 1)});
+        }
+        return r;
+    }
+
+    // the filled box, or the window when opened
+    Rect getOpaqueBounds(TFTLIB *tft) override
+    {
+        if (!isOpened)
+            return {(int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h};
+        window(tft);
+        return {(int16_t)ddX, (int16_t)ddY, (int16_t)ddWidth, (int16_t)ddHeight};
+    }
+
     void draw(TFTLIB *tft) override
     {
         if (darkMode)
@@ -1362,27 +3318,20 @@ protected:
         // print selectedOption
         tft->setCursor(x + 7, y + ((h - fH) / 2) + 1);
 
-        // Check if text is to long for box
-        bool shortened = false;
-        char toPrint[100];
-        int tXsize = tft->strPixelLen(t);
-        toPrint[0] = '\0';
-        if (strlen(t) < 100)
-            for (uint8_t i = 0; i < strlen(t); i++)
-            {
-                toPrint[i] = t[i];
-                toPrint[i + 1] = '\0';
-                tXsize = tft->strPixelLen(toPrint);
-                if (tXsize > w - 14 - h)
-                {
-                    toPrint[i] = '\0';
-                    shortened = true;
-                    break;
-                }
-            }
+        // Check if text is to long for box, only measured again when the text changed
+        if (t != _fitText || fH != _fitH)
+        {
+            _fitText = t;
+            _fitH = fH;
+            _fitLength = fitLength(tft, t, w - 14 - h);
+        }
 
+        char toPrint[100];
+        uint8_t length = min(_fitLength, (uint8_t)(sizeof(toPrint) - 1));
+        memcpy(toPrint, t, length);
+        toPrint[length] = '\0';
         tft->print(toPrint);
-        if (shortened)
+        if (t[length] != '\0')
             tft->print((char *)"...");
 
         // down-button
@@ -1396,169 +3345,676 @@ protected:
 
         if (isOpened)
         {
-            uint8_t margin = 5;
+            window(tft);
+
+            // background
+            tft->fillRect(ddX, ddY, ddWidth, ddHeight, colorBrigthness(myBackColor, 0));
+            // border
+            tft->drawRect(ddX, ddY, ddWidth, ddHeight, colorBrigthness(myBackColor, -55));
+
+            // only the visible options
+            uint16_t oneHeight = rowHeight();
+            for (uint16_t row = 0; row < _rows; row++)
+            {
+                uint16_t i = _first + row;
+                uint16_t rowY = ddY + row * oneHeight;
+
+                // highligt selected index
+                if (i == _selectedIndex)
+                    tft->fillRect(ddX + 1, rowY + 1, ddWidth - 2, oneHeight - 1, colorBrigthness(myBackColor, -30));
+
+                char *text = option(i);
+                if (text != NULL)
+                {
+                    tft->setCursor(ddX + DROPDOWNMARGIN, rowY + DROPDOWNMARGIN);
+                    tft->print(text);
+                }
+                if (row > 0)
+                    tft->drawLine(ddX, rowY, ddX + ddWidth - 1, rowY, colorBrigthness(myBackColor, -55));
+            }
+
+            // scroll bar
+            if (_optionsCount > _rows)
+            {
+                uint16_t barH = max((uint16_t)(ddHeight * _rows / _optionsCount), (uint16_t)8);
+                uint16_t barY = ddY + (uint32_t)(ddHeight - barH) * _first / (_optionsCount - _rows);
+                tft->fillRect(ddX + ddWidth - 4, barY, 3, barH, colorBrigthness(myBackColor, -55));
+            }
+        }
+    }
+
+    void resized() override
+    {
+        _fitText = NULL;
+    }
+
+    void internalOnClickHandler(int touchX, int touchY)
+    {
+        int16_t ptcX = touchX - x;
+        uint32_t now = millis();
+
+        if (isOpened)
+        {
+            bool inWindow = enabled && touchX >= ddX && touchX <= ddX + ddWidth && touchY >= ddY && touchY <= ddY + ddHeight;
+
+            if (inWindow)
+            {
+                _isTouched = true;
+                if (now - _lastSample > DROPDOWNRELEASE)
+                {
+                    // new touch
+                    _touchY = touchY;
+                    _touchFirst = _first;
+                    _dragged = false;
+                }
+                else if (abs(touchY - _touchY) > rowHeight() / 2)
+                {
+                    // drag: the options follow the finger
+                    _dragged = true;
+                    int32_t first = _touchFirst + (int32_t)(_touchY - touchY) / (int32_t)rowHeight();
+                    first = constrain(first, 0, (int32_t)(_optionsCount - _rows));
+                    if (first != _first)
+                    {
+                        _first = first;
+                        _dirty = true;
+                    }
+                }
+                _lastSample = now;
+                _lastRow = (touchY - ddY) / rowHeight();
+                return;
+            }
 
-            // dropDown window width
-            for (uint8_t i = 0; i < 8; i++)
+            // released: a touch without dragging selects
+            if (_lastSample != 0 && now - _lastSample > DROPDOWNRELEASE)
             {
-                if (options[i] != (char *)"\0" && options[i] != NULL)
+                _lastSample = 0;
+                if (!_dragged && _lastRow < _rows)
                 {
-                    ddWidth = tft->strPixelLen(options[i]);
-                    if (ddWidth > maxStrLen)
-                        maxStrLen = ddWidth;
+                    setSelectedIndex(_first + _lastRow);
+                    priorized = false;
+                    isOpened = false;
                 }
+                _dirty = true;
+                return;
             }
-            ddWidth = maxStrLen + 2 * margin;
 
-            // dropDown window height
-            ddHeight = _optionsCount * (fH + 2 * margin);
+            if (_lastSample != 0)
+                return;
+        }
 
-            // dropDown window position
-            ddX = x;
-            ddY = y + h + 2;
+        // check if touchX on open button, once per touch
+        if (ptcX >= w - h && ptcX <= w && touchY >= y && touchY <= y + h && now - _lastButton > DROPDOWNRELEASE * 2)
+        {
+            _lastButton = now;
 
-            // avoid overflow right
-            if (ddX + ddWidth > tft->width() - 1)
+            // down touched
+            if (isOpened)
+            {
+                priorized = false;
+                isOpened = false;
+            }
+            else
             {
-                ddX -= ddX + ddWidth - tft->width() - 1;
+                priorized = true;
+                isOpened = true;
+                _opened = false;
+                clearWidths();
             }
+            _dirty = true;
+        }
+    }
+
+private:
+    bool isOpened = false;
+    bool _opened = false; // window placed since opening
+    int16_t _selectedIndex = -1;
+    uint16_t _optionsCount = 0;
+    char *options[8];
+    char *(*_provider)(uint16_t index) = nullptr;
+    uint16_t myForeColor = 0x0000;
+    uint16_t myBackColor = 0xFFDF;
+
+    // visible window of options
+    uint16_t _first = 0;
+    uint16_t _rows = 0;
+
+    // touch in the window
+    uint32_t _lastSample = 0;
+    uint32_t _lastButton = 0;
+    int16_t _touchY = 0;
+    uint16_t _touchFirst = 0;
+    uint16_t _lastRow = 0;
+    bool _dragged = false;
+
+    // widths of options seen since opening, by index modulo DROPDOWNWIDTHS
+    int32_t _widthIndex[DROPDOWNWIDTHS];
+    uint16_t _width[DROPDOWNWIDTHS];
+    uint16_t _maxWidth = 0;
+
+    // shown part of the selected text
+    char *_fitText = NULL;
+    uint8_t _fitH = 0;
+    uint8_t _fitLength = 0;
+
+    char *option(uint16_t index)
+    {
+        if (index >= _optionsCount)
+            return NULL;
+        return _provider != nullptr ? _provider(index) : options[index];
+    }
+
+    uint16_t rowHeight()
+    {
+        return fH + 2 * DROPDOWNMARGIN;
+    }
+
+    void clearWidths()
+    {
+        for (uint8_t i = 0; i < DROPDOWNWIDTHS; i++)
+            _widthIndex[i] = -1;
+        _maxWidth = 0;
+    }
+
+    uint16_t optionWidth(TFTLIB *tft, uint16_t index)
+    {
+        uint8_t slot = index % DROPDOWNWIDTHS;
+        if (_widthIndex[slot] != index)
+        {
+            char *text = option(index);
+            _widthIndex[slot] = index;
+            _width[slot] = text != NULL ? tft->strPixelLen(text) : 0;
+        }
+        return _width[slot];
+    }
+
+    // size and position of the dropDown window, only the visible options are measured
+    void window(TFTLIB *tft)
+    {
+        uint16_t oneHeight = rowHeight();
+        _rows = min(_optionsCount, (uint16_t)DROPDOWNROWS);
+        if (_rows * oneHeight > tft->height() - 2)
+            _rows = (tft->height() - 2) / oneHeight;
+
+        // show the selected option when opened
+        if (!_opened)
+        {
+            _opened = true;
+            if (_selectedIndex >= 0 && (_selectedIndex < _first || _selectedIndex >= _first + _rows))
+                _first = _selectedIndex >= _rows / 2 ? _selectedIndex - _rows / 2 : 0;
+        }
+        if (_first + _rows > _optionsCount)
+            _first = _optionsCount - _rows;
+
+        tft->setFont(f);
+        for (uint16_t row = 0; row < _rows; row++)
+            _maxWidth = max(_maxWidth, optionWidth(tft, _first + row));
+
+        // the window does not get narrower while scrolling
+        ddWidth = max((uint16_t)(_maxWidth + 2 * DROPDOWNMARGIN + (_optionsCount > _rows ? 4 : 0)), w);
+        ddHeight = _rows * oneHeight;
+
+        // dropDown window position
+        ddX = x;
+        ddY = y + h + 2;
+
+        // avoid overflow right
+        if (ddX + ddWidth > tft->width() - 1)
+            ddX = ddWidth < tft->width() - 1 ? tft->width() - 1 - ddWidth : 0;
+
+        // avoid overflow bottom
+        if (ddY + ddHeight > tft->height() - 1)
+            ddY = tft->height() - 1 - ddHeight;
+    }
+
+    // chars of text that fit into maxWidth
+    static uint8_t fitLength(TFTLIB *tft, const char *text, int16_t maxWidth)
+    {
+        char part[100];
+        uint8_t length = 0;
+        while (text[length] != '\0' && length < sizeof(part) - 1)
+        {
+            part[length] = text[length];
+            part[length + 1] = '\0';
+            if (tft->strPixelLen(part) > maxWidth)
+                break;
+            length++;
+        }
+        return length;
+    }
+};
+
+class TextBox : public Control
+{
+    static_assert(TEXTBOXLENGTH > 0 && TEXTBOXLENGTH < sizeof(str), "TEXTBOXLENGTH chars have to fit into str");
+
+public:
+    TextBox()
+    {
+        type = TEXTBOX;
+    };
+
+    TextBox(int xPos, int yPos, int width, int height, void (*function)() = nullptr)
+    {
+        x = xPos;
+        y = yPos;
+        if (width >= 48)
+            w = width;
+        else
+            w = 48;
+        if (height >= 24)
+            h = height;
+        else
+            h = 24;
+        clickHandler = function;
+        t = (char *)"\0";
+        type = TEXTBOX;
+    };
+
+    // text storage of size bytes (size - 1 chars), the current text is kept as far as it fits
+    // false without room for the terminating 0, the old buffer is kept then
+    bool setBuffer(char *buffer, uint16_t size)
+    {
+        if (buffer == NULL || size < 1)
+            return false;
+
+        char *old = getText();
+        uint16_t length = min((uint16_t)strlen(old), (uint16_t)(size - 1));
+        memmove(buffer, old, length);
+        _buffer = buffer;
+        _capacity = size - 1;
+        _gapStart = length;
+        _gapEnd = _capacity;
+        taken();
+        reset();
+        return true;
+    }
+
+    // the whole text, the gap is moved behind it
+    char *getText()
+    {
+        sync();
+        moveGap(length());
+        _buffer[_gapStart] = '\0';
+        return _buffer;
+    }
+
+    uint16_t getLength()
+    {
+        sync();
+        return length();
+    }
+
+    uint16_t getCapacity()
+    {
+        return _capacity;
+    }
+
+    // inserts at the caret (replaces the selection), char 8 is backspace; false if the text is full
+    bool addText(char *text)
+    {
+        sync();
+        if (text[0] == 8)
+        {
+            if (!deleteSelection() && _caret > 0)
+                erase(_caret - 1, _caret);
+            return true;
+        }
+
+        deleteSelection();
+        for (; *text != '\0'; text++)
+        {
+            if (_gapStart == _gapEnd)
+                return false;
+
+            moveGap(_caret);
+            _buffer[_gapStart++] = *text;
+            changed(_caret);
+            uint8_t a = advance(*text);
+            _caretX += a;
+            _textW += a;
+            _caret++;
+        }
+        scroll();
+        return true;
+    }
+
+    bool addText(long text)
+    {
+        char buf[14];
+        NumberFormat::formatInt(text, buf);
+        return addText(buf);
+    }
+
+    void clear()
+    {
+        sync();
+        _gapStart = 0;
+        _gapEnd = _capacity;
+        reset();
+    }
+
+    void setCaret(uint16_t position)
+    {
+        sync();
+        if (hasSelection())
+            changed(_selStart);
+        _selStart = _selEnd = 0;
+        moveCaret(min(position, length()));
+        scroll();
+    }
+
+    uint16_t getCaret()
+    {
+        return _caret;
+    }
+
+    // selects from (inclusive) to (exclusive), the caret goes to the end
+    void select(uint16_t from, uint16_t to)
+    {
+        sync();
+        from = min(from, length());
+        to = min(to, length());
+        changed(min(_selStart, from));
+        _selStart = min(from, to);
+        _selEnd = max(from, to);
+        moveCaret(_selEnd);
+        scroll();
+    }
+
+    void selectAll()
+    {
+        select(0, getLength());
+    }
+
+    bool hasSelection()
+    {
+        return _selEnd > _selStart;
+    }
+
+    // shows the caret
+    void setFocus(bool focus)
+    {
+        if (focus != _focused)
+        {
+            _focused = focus;
+            changed(_caret);
+        }
+    }
+
+protected:
+    Rect getBounds(TFTLIB *tft) override
+    {
+        return {(int16_t)x, (int16_t)y, (int16_t)(w + 1), (int16_t)max(h + 1, fH + (h - fH) / 2 + f.line_space + 4)};
+    }
+
+    void draw(TFTLIB *tft) override
+    {
+        sync();
+        colors();
+        tft->setFont(f);
+        if (_measure == NULL || fontChanged())
+            measure(tft);
+
+        // background
+        tft->fillRect(x, y, w, h, colorBrigthness(myBackColor, 0));
+        // border
+        tft->drawRect(x, y, w, h, colorBrigthness(myBackColor, -55));
+        tft->drawRect(x + 1, y + 1, w - 2, h - 2, colorBrigthness(myBackColor, -20));
+
+        drawText(tft, _first, _first);
+
+        _textDrawn = true;
+        _drawnX = x;
+        _drawnY = y;
+        _drawnColor = myBackColor;
+    }
 
-            // avoid overflow bottom
-            if (ddY + ddHeight > tft->height() - 1)
-            {
-                ddY -= ddY + ddHeight - tft->height() - 1;
-            }
+    // text edits and caret moves draw the text from the first change on
+    bool canDrawChanges() override
+    {
+        colors();
+        return _textDrawn && x == _drawnX && y == _drawnY && myBackColor == _drawnColor && t == _buffer + _capacity &&
+               !fontChanged();
+    }
 
-            // background
-            tft->fillRect(ddX, ddY, ddWidth, ddHeight, colorBrigthness(myBackColor, 0));
-            // border
-            tft->drawRect(ddX, ddY, ddWidth, ddHeight, colorBrigthness(myBackColor, -55));
+    // scrolled again for the new width
+    void resized() override
+    {
+        _measure = NULL;
+        _textDrawn = false;
+    }
 
-            if (_selectedIndex >= 0)
-            {
-                // highligt selected index
-                uint16_t oneHeight = ddHeight / _optionsCount;
+    void drawChanges(TFTLIB *tft) override
+    {
+        // scrolled: all visible chars, otherwise from the first change on
+        uint16_t from = _first != _drawnFirst ? _first : max(_changedFrom, _first);
+        if (from > length())
+            return;
 
-                tft->fillRect(ddX + 1, ddY + 1 + _selectedIndex * oneHeight, ddWidth - 2, oneHeight - 1, colorBrigthness(myBackColor, -30));
-            }
+        // the area of the changed chars is cleared, the char before is drawn again in case it overhangs
+        int16_t left = textX() + offset(_first, from);
+        if (left > x + w - 3)
+            return;
 
-            for (uint8_t i = 0; i < 8; i++)
-            {
-                if (options[i] != (char *)"\0" && options[i] != NULL)
-                {
-                    tft->setCursor(ddX + margin, ddY + margin + (i * (fH + 2 * margin)));
-                    tft->print(options[i]);
-                    tft->drawLine(ddX, ddY + (i * (fH + 2 * margin)), ddX + ddWidth - 1, ddY + (i * (fH + 2 * margin)), colorBrigthness(myBackColor, -55));
-                }
-            }
-        }
+        tft->setFont(f);
+        tft->fillRect(left, y + 2, x + w - 2 - left, h - 4, colorBrigthness(myBackColor, 0));
+        drawText(tft, from > _first ? from - 1 : from, from);
     }
 
     void internalOnClickHandler(int touchX, int touchY)
     {
-        int16_t ptcX = touchX - x;
-
-        if (isOpened)
-        {
-            // check if dd window is touched
-            if (enabled && touchX >= ddX && touchX <= ddX + ddWidth && touchY >= ddY && touchY <= ddY + ddHeight)
-            {
-                _isTouched = true;
-                int16_t ptddY = touchY - ddY; // point of click in dd-window
-                uint16_t oneHeight = ddHeight / _optionsCount;
-                _selectedIndex = ptddY / oneHeight;
-                t = options[_selectedIndex];
-                priorized = false;
-                isOpened = false;
-                return;
-            }
-        }
+        sync();
+        setFocus(true);
 
-        // check if touchX on open button
-        if (ptcX >= w - h && ptcX <= w)
+        // caret to the nearest char boundary
+        uint16_t position = _first;
+        int16_t left = textX();
+        while (position < length())
         {
-            // down touched
-            if (isOpened)
-            {
-                priorized = false;
-                isOpened = false;
-            }
-            else
-            {
-                priorized = true;
-                isOpened = true;
-            }
+            uint8_t a = advance(charAt(position));
+            if (left + a / 2 > touchX)
+                break;
+            left += a;
+            position++;
         }
+        setCaret(position);
     }
 
 private:
-    bool isOpened = false;
-    uint16_t maxStrLen = 0;
-    int8_t _selectedIndex = -1;
-    uint8_t _optionsCount = 0;
-    char *options[8];
     uint16_t myForeColor = 0x0000;
     uint16_t myBackColor = 0xFFDF;
-};
 
-class TextBox : public Control
-{
-public:
-    TextBox()
+    // gap buffer: text before the caret in [0, _gapStart), after it in [_gapEnd, _capacity)
+    char *_buffer = str;
+    uint16_t _capacity = TEXTBOXLENGTH;
+    uint16_t _gapStart = 0;
+    uint16_t _gapEnd = TEXTBOXLENGTH;
+
+    uint16_t _caret = 0;
+    uint16_t _selStart = 0;
+    uint16_t _selEnd = 0;
+    bool _focused = false;
+
+    // pixel positions from the start of the text, kept up to date while editing
+    uint16_t _first = 0; // first visible char
+    uint16_t _firstX = 0;
+    uint16_t _caretX = 0;
+    uint16_t _textW = 0;
+
+    // advance of the printable ASCII chars in the current font, 0xFF = not measured
+    TFTLIB *_measure = NULL;
+    uint8_t _advance[95];
+    FONTS _advanceFont;
+
+    // state of the last draw
+    bool _textDrawn = false;
+    uint16_t _drawnX = 0;
+    uint16_t _drawnY = 0;
+    uint16_t _drawnColor = 0;
+    uint16_t _drawnFirst = 0;
+    uint16_t _changedFrom = 0xFFFF;
+
+    uint16_t length()
     {
-        type = TEXTBOX;
-    };
+        return _capacity - (_gapEnd - _gapStart);
+    }
 
-    TextBox(int xPos, int yPos, int width, int height, void (*function)() = nullptr)
+    char charAt(uint16_t i)
     {
-        x = xPos;
-        y = yPos;
-        if (width >= 48)
-            w = width;
-        else
-            w = 48;
-        if (height >= 24)
-            h = height;
-        else
-            h = 24;
-        clickHandler = function;
-        t = (char *)"\0";
-        type = TEXTBOX;
-    };
+        return i < _gapStart ? _buffer[i] : _buffer[i + _gapEnd - _gapStart];
+    }
 
-    char *getText()
+    void moveGap(uint16_t position)
+    {
+        if (position < _gapStart)
+        {
+            uint16_t n = _gapStart - position;
+            memmove(_buffer + _gapEnd - n, _buffer + position, n);
+            _gapStart -= n;
+            _gapEnd -= n;
+        }
+        else if (position > _gapStart)
+        {
+            uint16_t n = position - _gapStart;
+            memmove(_buffer + _gapStart, _buffer + _gapEnd, n);
+            _gapStart += n;
+            _gapEnd += n;
+        }
+    }
+
+    // text set with setText() or posted, taken over into the buffer
+    void sync()
     {
-        return t;
+        if (t == _buffer + _capacity)
+            return;
+
+        uint16_t n = min((uint16_t)strlen(t), _capacity);
+        memmove(_buffer, t, n);
+        _gapStart = n;
+        _gapEnd = _capacity;
+        taken();
+        reset();
     }
 
-    void addText(char *text)
+    // t points to the 0 behind the buffer while the text is in the buffer, the setters of Control write their text
+    // to the start of str and point t there, so a new text is seen even with str as buffer
+    void taken()
     {
-        if (text[0] == 8)
+        _buffer[_capacity] = '\0';
+        t = _buffer + _capacity;
+    }
+
+    // caret to the end, positions measured again
+    void reset()
+    {
+        _selStart = _selEnd = 0;
+        _first = _firstX = 0;
+        _textW = offset(0, length());
+        _caret = length();
+        _caretX = _textW;
+        changed(0);
+        scroll();
+    }
+
+    // removes chars from (inclusive) to (exclusive)
+    void erase(uint16_t from, uint16_t to)
+    {
+        moveCaret(to);
+        moveGap(to);
+        uint16_t width = offset(from, to);
+        _gapStart = from;
+        _caret = from;
+        _caretX -= width;
+        _textW -= width;
+        if (_first > from)
         {
-            if (strlen(t) > 0)
-                t[strlen(t) - 1] = '\0';
+            _first = from;
+            _firstX = _caretX;
         }
+        changed(from);
+        scroll();
+    }
+
+    bool deleteSelection()
+    {
+        if (!hasSelection())
+            return false;
+
+        uint16_t from = _selStart, to = _selEnd;
+        _selStart = _selEnd = 0;
+        erase(from, to);
+        return true;
+    }
+
+    void moveCaret(uint16_t position)
+    {
+        changed(min(_caret, position));
+        if (position > _caret)
+            _caretX += offset(_caret, position);
         else
-        {
-            strcpy(str, t);
-            strcat(str, text);
+            _caretX -= offset(position, _caret);
+        _caret = position;
+    }
 
-            t = str;
+    // first visible char so that the caret is visible and no space is left at the end
+    void scroll()
+    {
+        uint16_t width = textWidth();
+        if (_caret < _first)
+        {
+            _first = _caret;
+            _firstX = _caretX;
         }
+        while (_caretX - _firstX > width && _first < _caret)
+            _firstX += advance(charAt(_first++));
+        while (_first > 0 && _textW - _firstX + advance(charAt(_first - 1)) <= width)
+            _firstX -= advance(charAt(--_first));
     }
 
-    void addText(long text)
+    void changed(uint16_t from)
     {
-        char buf[14];
-        ltoa(text, buf, 10);
-        strcpy(str, t);
-        strcat(str, buf);
+        if (from < _changedFrom)
+            _changedFrom = from;
+        _dirty = true;
+    }
 
-        t = str;
+    // positions are measured with the first draw
+    uint8_t advance(char c)
+    {
+        if (_measure == NULL)
+            return 0;
+
+        char one[2] = {c, '\0'};
+        if (c < ' ' || c > '~')
+            return _measure->strPixelLen(one);
+
+        uint8_t &a = _advance[c - ' '];
+        if (a == 0xFF)
+            a = _measure->strPixelLen(one);
+        return a;
     }
 
-protected:
-    void draw(TFTLIB *tft) override
+    // width of the chars from (inclusive) to (exclusive)
+    uint16_t offset(uint16_t from, uint16_t to)
+    {
+        uint16_t width = 0;
+        for (uint16_t i = from; i < to; i++)
+            width += advance(charAt(i));
+        return width;
+    }
+
+    int16_t textX()
+    {
+        return x + h / 2 - (f.cap_height + 2) / 2;
+    }
+
+    // room for text in the box
+    uint16_t textWidth()
+    {
+        return x + w - 4 - textX();
+    }
+
+    void colors()
     {
         if (darkMode)
         {
@@ -1570,64 +4026,57 @@ protected:
             myBackColor = backColor;
             myForeColor = foreColor;
         }
+    }
 
-        tft->setFont(f);
-        tft->setTextColor(myForeColor);
-
-        // background
-        tft->fillRect(x, y, w, h, colorBrigthness(myBackColor, 0));
-        // border
-        tft->drawRect(x, y, w, h, colorBrigthness(myBackColor, -55));
-        tft->drawRect(x + 1, y + 1, w - 2, h - 2, colorBrigthness(myBackColor, -20));
+    // the cached advances belong to one font
+    bool fontChanged()
+    {
+        return memcmp(&_advanceFont, &f, sizeof(FONTS)) != 0;
+    }
 
-        // value
-        tft->setCursor(x + h / 2 - (f.cap_height + 2) / 2, y + ((h - fH) / 2) + 1);
+    void measure(TFTLIB *tft)
+    {
+        _measure = tft;
+        memcpy(&_advanceFont, &f, sizeof(FONTS));
+        memset(_advance, 0xFF, sizeof(_advance));
+        _first = _firstX = 0;
+        _textW = offset(0, length());
+        _caretX = offset(0, _caret);
+        scroll();
+    }
 
-        bool toLong = false;
-        bool shortened = false;
-        char toPrint[100];
-        strcpy(toPrint, t);
-        int tXsize = tft->strPixelLen(toPrint);
-        if (tXsize > w - 14)
-            toLong = true;
-        int offset = 0;
+    // visible chars from from on (selection marked from cleared on), the caret on top
+    void drawText(TFTLIB *tft, uint16_t from, uint16_t cleared)
+    {
+        int16_t left = textX() + offset(_first, from);
+        int16_t right = x + w - 4;
+        int16_t textY = y + ((h - fH) / 2) + 1;
+        uint16_t selColor = colorBrigthness(myBackColor, -30);
 
-        while (toLong)
+        tft->setTextColor(myForeColor);
+        for (uint16_t i = from; i < length(); i++)
         {
-            for (uint8_t i = 0; i < strlen(t); i++)
-            {
-                toPrint[i] = t[strlen(t) - i - 1];
-                toPrint[i + 1] = '\0';
-                tXsize = tft->strPixelLen(toPrint);
-                if (tXsize > w - 14)
-                {
-                    offset = strlen(t) - i + 2;
-                    toLong = false;
-                    shortened = true;
-                    break;
-                }
-            }
+            char c = charAt(i);
+            uint8_t a = advance(c);
+            if (left + a > right)
+                break;
+
+            if (i >= _selStart && i < _selEnd && i >= cleared)
+                tft->fillRect(left, y + 3, a, h - 6, selColor);
+            tft->setCursor(left, textY);
+            tft->print(c);
+            left += a;
         }
 
-        for (uint8_t i = 0; i < strlen(t) - offset + 1; i++)
+        if (_focused)
         {
-            toPrint[i] = t[i + offset];
+            int16_t caretX = textX() + _caretX - _firstX;
+            tft->drawFastVLine(caretX, y + 4, h - 8, myForeColor);
         }
-        toPrint[strlen(t) - offset + 1] = '\0';
-
-        if (shortened)
-            tft->print("...");
 
-        tft->print(toPrint);
-    }
-
-    void internalOnClickHandler(int touchX, int touchY)
-    {
+        _drawnFirst = _first;
+        _changedFrom = 0xFFFF;
     }
-
-private:
-    uint16_t myForeColor = 0x0000;
-    uint16_t myBackColor = 0xFFDF;
 };
 
 class NumPad : public Control
@@ -1676,12 +4125,78 @@ public:
         return lastClicked;
     }
 
+    // own atlas of count pixels (both key faces), e.g. for NumPads shown at the same time, NULL for the shared one
+    void setAtlas(uint16_t *pixels, uint32_t count)
+    {
+        _atlas = pixels;
+        _atlasPixels = pixels != NULL ? count : NUMPADATLASPIXELS;
+        _atlasW = 0;
+        _screenW = 0; // keys fitted again
+        _dirty = true;
+    }
+
 protected:
+    Rect getBounds(TFTLIB *tft) override
+    {
+        if (!enabled)
+            return {0, 0, 0, 0};
+        layout(tft);
+        return {(int16_t)x, (int16_t)y, (int16_t)(w + 1), (int16_t)(h + 1)};
+    }
+
+    // one line NumPad in landscape, 4x4 block in portrait, computed again when the display size or rotation changes
+    void layout(TFTLIB *tft)
+    {
+        if (tft->width() == _screenW && tft->height() == _screenH)
+            return;
+        _screenW = tft->width();
+        _screenH = tft->height();
+
+        if (tft->width() > tft->height())
+        {
+            _keys = "0123456789.<X";
+            _cols = 13;
+            _rows = 1;
+            _keyW = tft->width() / 13 - 4;
+            _keyH = oneH;
+        }
+        else
+        {
+            _keys = "789<"
+                    "456X"
+                    "123 "
+                    " 0. ";
+            _cols = 4;
+            _rows = 4;
+            _keyW = min(tft->width() / 4 - 4, 56);
+            _keyH = NUMPADMAXKEYH;
+        }
+
+        // both faces have to fit into the atlas
+        while (2 * _keyW * _keyH > _atlasPixels)
+            _keyW--;
+
+        w = _cols * (_keyW + 2);
+        h = _rows * (_keyH + 2) - 2;
+        x = tft->width() / 2 - w / 2;
+        if (y == 65000 || _defaultY)
+        {
+            y = tft->height() - h - oneH - 1;
+            _defaultY = true;
+        }
+    }
+
+    // takes the touches while shown, also if BUI skips its draw
+    void refresh() override
+    {
+        Control::refresh();
+        priorized = enabled;
+    }
+
     void draw(TFTLIB *tft) override
     {
         if (enabled)
         {
-            priorized = true;
             if (darkMode)
             {
                 myBackColor = 0x6B4D;
@@ -1693,102 +4208,245 @@ protected:
                 myForeColor = foreColor;
             }
 
+            layout(tft);
+
+            // key faces are rendered once per size and colors
+            if (_atlasW != _keyW || _atlasH != _keyH || _atlasColor != myBackColor || atlasOwner() != this)
+                renderFaces();
+
             tft->setFont(f);
             tft->setTextColor(myForeColor);
 
-            if (tft->width() > tft->height()) // landscape --> one line NumPad
-            {
-                oneW = tft->width() / 13 - 4;
-                w = 13 * (oneW + 2);
-                h = oneH;
-                x = tft->width() / 2 - w / 2;
-                if (y == 65000)
-                    y = tft->height() - 2 * oneH - 1;
-
-                for (int i = 0; i < 13; i++)
-                {
-                    // button xPos
-                    uint16_t xPos = x + i * (oneW + 2);
-
-                    // shape of button
-                    // upper half background
-                    tft->fillRect(xPos + 2, y + 2, oneW - 4, h / 2 - 2, colorBrigthness(myBackColor, 0));
-                    // lower half background
-                    tft->fillRect(xPos + 2, y + h / 2, oneW - 4, h / 2 - 2, colorBrigthness(myBackColor, -25));
-                    // transition between the two halves
-                    tft->drawLine(xPos + 2, y + h / 2, xPos + oneW - 2, y + h / 2, colorBrigthness(myBackColor, -8));
-                    tft->drawLine(xPos + 2, y + 1 + h / 2, xPos + oneW - 2, y + 1 + h / 2, colorBrigthness(myBackColor, -16));
-                    // inner border
-                    tft->drawRoundRect(xPos + 1, y + 1, oneW - 2, h - 2, 2, colorBrigthness(myBackColor, 11));
-                    // outer border
-                    tft->drawRoundRect(xPos, y, oneW, h, 3, colorBrigthness(myBackColor, -55));
-
-                    // number
-                    tft->setCursor(xPos + (oneW / 2) - 4, y + ((h - fH) / 2) + 1);
-                    tft->setTextColor(myForeColor);
-                    if (i < 10)
-                        tft->print(i);
-                    else if (i < 11)
-                        tft->print(".");
-                    else if (i < 12)
-                        tft->print("<");
-                    else if (i < 13)
-                        tft->print("X");
-                }
-            }
-            else // portrait --> block NumPad
+            for (uint8_t i = 0; i < _rows * _cols; i++)
             {
-                // TODO
+                if (_keys[i] == ' ')
+                    continue;
+
+                uint16_t xPos = x + (i % _cols) * (_keyW + 2);
+                uint16_t yPos = y + (i / _cols) * (_keyH + 2);
+                drawFace(tft, xPos, yPos, i == _pressed);
+
+                // number
+                tft->setCursor(xPos + (_keyW / 2) - 4, yPos + ((_keyH - fH) / 2) + 1);
+                tft->print(_keys[i]);
             }
         }
-        else
-        {
-            priorized = false;
-        }
     }
 
     void internalOnClickHandler(int touchX, int touchY)
     {
-        float ptcX = touchX - x;
-        float ptcY = touchY - y;
-        int clickIndex = ptcX / (oneW + 2);
+        int key = keyAt(touchX, touchY);
 
-        if (ptcY > 0 && ptcY <= h)
+        if (key < 0)
         {
-            if (clickIndex >= 12 && clickIndex < 13) // x
+            // pressed face is shown a moment after the touch
+            if (_pressed >= 0 && millis() - _pressedAt >= 120)
             {
-                enabled = false;
+                _pressed = -1;
+                _dirty = true;
             }
-            else
-            {
-                if (clickIndex >= 11) //<
-                {
-                    lastClicked = bs;
-                }
-                else if (clickIndex >= 10) //.
-                {
-                    lastClicked = (char *)".";
-                }
-                else
-                {
-                    char buf[2];
-                    ltoa(clickIndex, buf, 10);
-                    lastClicked = buf;
-                }
+            return;
+        }
 
-                if (clickHandler != nullptr)
-                {
-                    clickHandler();
-                }
-            }
+        _pressed = key;
+        _pressedAt = millis();
+
+        if (_keys[key] == 'X')
+        {
+            enabled = false;
+            _pressed = -1;
+            return;
+        }
+
+        if (_keys[key] == '<')
+            lastClicked = bs;
+        else
+        {
+            _clicked[0] = _keys[key];
+            lastClicked = _clicked;
+        }
+
+        if (clickHandler != nullptr)
+        {
+            clickHandler();
         }
     }
 
 private:
     char bs[2] = {8, 0}; // backspace
-    char *lastClicked = '\0';
-    uint8_t oneW;
+    char _clicked[2] = {0, 0};
+    char *lastClicked = _clicked;
     uint8_t oneH = 30;
     uint16_t myForeColor = 0x0000;
     uint16_t myBackColor = 0xFFDF;
+    bool _defaultY = false; // y follows the size of the NumPad
+    uint16_t _screenW = 0; // display size of the layout
+    uint16_t _screenH = 0;
+
+    // keys row by row, ' ' is a gap
+    const char *_keys = "0123456789.<X";
+    uint8_t _cols = 13;
+    uint8_t _rows = 1;
+    uint8_t _keyW = 0;
+    uint8_t _keyH = 30;
+    int8_t _pressed = -1;
+    uint32_t _pressedAt = 0;
+
+    // normal and pressed key face, one after another; first and last painted pixel of every line (corners are not painted)
+    uint16_t *_atlas = NULL; // NULL: the shared one
+    uint32_t _atlasPixels = NUMPADATLASPIXELS;
+    uint8_t _first[NUMPADMAXKEYH];
+    uint8_t _last[NUMPADMAXKEYH];
+    uint8_t _atlasW = 0;
+    uint8_t _atlasH = 0;
+    uint16_t _atlasColor = 0;
+
+    static uint16_t *sharedAtlas()
+    {
+        static uint16_t atlas[NUMPADATLASPIXELS];
+        return atlas;
+    }
+
+    // NumPad whose faces are in the shared atlas
+    static NumPad *&sharedOwner()
+    {
+        static NumPad *owner = NULL;
+        return owner;
+    }
+
+    uint16_t *atlas()
+    {
+        return _atlas != NULL ? _atlas : sharedAtlas();
+    }
+
+    const NumPad *atlasOwner()
+    {
+        return _atlas != NULL ? this : sharedOwner();
+    }
+
+    // index of the key at touchX, touchY or -1
+    int keyAt(int touchX, int touchY)
+    {
+        if (_keyW == 0 || touchX < x || touchY < y)
+            return -1;
+
+        uint16_t col = (touchX - x) / (_keyW + 2);
+        uint16_t row = (touchY - y) / (_keyH + 2);
+        if (col >= _cols || row >= _rows || _keys[row * _cols + col] == ' ')
+            return -1;
+        return row * _cols + col;
+    }
+
+    // the shape of a Button (style 0), the pressed face darker
+    void renderFaces()
+    {
+        for (uint8_t row = 0; row < _keyH; row++)
+        {
+            _first[row] = _keyW;
+            _last[row] = 0;
+        }
+
+        for (uint8_t pressed = 0; pressed < 2; pressed++)
+        {
+            uint16_t *face = atlas() + pressed * _keyW * _keyH;
+            int darken = pressed ? -30 : 0;
+            uint8_t kw = _keyW, kh = _keyH;
+
+            // upper half background
+            faceRect(face, 2, 2, kw - 4, kh / 2 - 2, colorBrigthness(myBackColor, darken));
+            // lower half background
+            faceRect(face, 2, kh / 2, kw - 4, kh / 2 - 2, colorBrigthness(myBackColor, -25 + darken));
+            // transition between the two halves
+            faceRect(face, 2, kh / 2, kw - 3, 1, colorBrigthness(myBackColor, -8 + darken));
+            faceRect(face, 2, kh / 2 + 1, kw - 3, 1, colorBrigthness(myBackColor, -16 + darken));
+            // inner border
+            faceRoundRect(face, 1, 1, kw - 2, kh - 2, 2, colorBrigthness(myBackColor, 11 + darken));
+            // outer border
+            faceRoundRect(face, 0, 0, kw, kh, 3, colorBrigthness(myBackColor, -55 + darken));
+        }
+
+        _atlasW = _keyW;
+        _atlasH = _keyH;
+        _atlasColor = myBackColor;
+        if (_atlas == NULL)
+            sharedOwner() = this;
+    }
+
+    void facePixel(uint16_t *face, int16_t col, int16_t row, uint16_t color)
+    {
+        if (col < 0 || row < 0 || col >= _keyW || row >= _keyH)
+            return;
+
+        face[row * _keyW + col] = color;
+        if (col < _first[row])
+            _first[row] = col;
+        if (col > _last[row])
+            _last[row] = col;
+    }
+
+    void faceRect(uint16_t *face, int16_t left, int16_t top, int16_t width, int16_t height, uint16_t color)
+    {
+        for (int16_t row = top; row < top + height; row++)
+            for (int16_t col = left; col < left + width; col++)
+                facePixel(face, col, row, color);
+    }
+
+    // same pixels as drawRoundRect of the TFT libraries
+    void faceRoundRect(uint16_t *face, int16_t left, int16_t top, int16_t width, int16_t height, int16_t r, uint16_t color)
+    {
+        faceRect(face, left + r, top, width - 2 * r, 1, color);
+        faceRect(face, left + r, top + height - 1, width - 2 * r, 1, color);
+        faceRect(face, left, top + r, 1, height - 2 * r, color);
+        faceRect(face, left + width - 1, top + r, 1, height - 2 * r, color);
+
+        // corners
+        int16_t f = 1 - r, ddX = 1, ddY = -2 * r, cx = 0, cy = r;
+        int16_t x1 = left + r, y1 = top + r, x2 = left + width - r - 1, y2 = top + height - r - 1;
+        while (cx < cy)
+        {
+            if (f >= 0)
+            {
+                cy--;
+                ddY += 2;
+                f += ddY;
+            }
+            cx++;
+            ddX += 2;
+            f += ddX;
+
+            facePixel(face, x2 + cx, y2 + cy, color);
+            facePixel(face, x2 + cy, y2 + cx, color);
+            facePixel(face, x2 + cx, y1 - cy, color);
+            facePixel(face, x2 + cy, y1 - cx, color);
+            facePixel(face, x1 - cy, y2 + cx, color);
+            facePixel(face, x1 - cx, y2 + cy, color);
+            facePixel(face, x1 - cy, y1 - cx, color);
+            facePixel(face, x1 - cx, y1 - cy, color);
+        }
+    }
+
+    // blits a face from the atlas, lines without corners in one writeRect
+    void drawFace(TFTLIB *tft, int16_t left, int16_t top, bool pressed)
+    {
+        const uint16_t *face = atlas() + (pressed ? _keyW * _keyH : 0);
+        uint8_t row = 0;
+        while (row < _keyH)
+        {
+            uint8_t end = row;
+            while (end < _keyH && _first[end] == 0 && _last[end] == _keyW - 1)
+                end++;
+
+            if (end > row)
+            {
+                tft->writeRect(left, top + row, _keyW, end - row, face + row * _keyW);
+                row = end;
+            }
+            else
+            {
+                if (_first[row] <= _last[row])
+                    tft->writeRect(left + _first[row], top + row, _last[row] - _first[row] + 1, 1, face + row * _keyW + _first[row]);
+                row++;
+            }
+        }
+    }
 };
\ No newline at end of file
@@ -0,0 +1,1000 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Display list for NOFRAMEBUFFER builds without band buffer: the shapes the controls draw are recorded as
+ * rectangles instead of being sent one by one. At the end of the frame (updateScreen(), called by BUI) the list
+ * is optimized and sent: rectangles painted over later are dropped or cut, the rest is sorted by lines and
+ * neighbouring rectangles of the same color are merged, so every remaining one is one address window.
+ *
+ *   #define NOFRAMEBUFFER
+ *   #define DISPLAYLIST
+ *   #include <ILI9486_t3n.h>
+ *   #include <BUI.h>
+ *
+ *   DisplayList tft(TFT_CS, TFT_DC, TFT_RST, TFT_MOSI, TFT_SCK, TFT_MISO); // instead of ILI9486_t3n
+ *   DisplayOp ops[400];                                                 // 10 bytes each
+ *   tft.setBuffer(ops, 400);
+ *
+ * Text and images are not recorded, the list up to there is sent before them. Drawing into a framebuffer (bands
+ * of setBandBuffer) is not recorded either. When the list is full, it is optimized and sent if still half full.
+ * Without setBuffer() everything is drawn straight away, like by the library.
+ *
+ * With DRAWPROFILE (also with a framebuffer) the pixels of everything drawn are counted into a DrawProfile.
+ *
+ * With PIPELINE, BUI::render() records whole frames into FrameRecords (see FrameRecord.h), texts and writeRect
+ * included, and the render task draws them with replay(). While recording, the library is not touched: clip rect,
+ * cursor, font and text color are kept here, so the render task can draw the last frame at the same time.
+ * Texts are recorded transparent (setTextColor with one color), like the controls draw them.
+ */
+
+struct DisplayOp
+{
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+    uint16_t color;
+};
+
+class DisplayList : public TFTLIB, private FontBits
+{
+    typedef TFTLIB Base;
+
+public:
+    using Base::Base;
+
+    void setBuffer(DisplayOp *ops, uint16_t count)
+    {
+        send();
+        _ops = ops;
+        _capacity = count;
+    }
+
+    // address windows the recorded shapes would have needed and the windows sent, since the start
+    uint32_t getOpsRecorded()
+    {
+        return _recorded;
+    }
+
+    uint32_t getOpsSent()
+    {
+        return _sent;
+    }
+
+#ifdef DRAWPROFILE
+    // counts the pixels drawn from now on, NULL to stop
+    void setProfile(DrawProfile *profile)
+    {
+        _profile = profile;
+    }
+
+    DrawProfile *getProfile()
+    {
+        return _profile;
+    }
+
+#endif
+
+#ifdef FRAMERECORD
+    // records everything drawn from now on into the records of pipe (BUI::render), wait(context) is called while
+    // all records are handed over
+    void record(FramePipe *pipe, void (*wait)(void *), void *context)
+    {
+        _pipe = pipe;
+        _wait = wait;
+        _waitContext = context;
+        _frame = NULL;
+    }
+
+    // hands the last record of the frame over and draws to the library again
+    void endFrame()
+    {
+        current()->last = true;
+        _pipe->publish();
+        _frame = NULL;
+        _pipe = NULL;
+    }
+
+    // draws a record into the framebuffer (render task)
+    void replay(const FrameRecord *record)
+    {
+        Base::setClipRect();
+        for (uint16_t i = 0; i < record->count; i++)
+        {
+            const FrameOp &op = record->ops[i];
+            if (op.kind == FRAMERECT)
+                Base::fillRect(op.x, op.y, op.w, op.h, op.value);
+            else
+                Base::writeRect(op.x, op.y, op.w, op.h, record->pixels + op.value);
+        }
+    }
+
+    // records handed over full, frames that did not fit into one record
+    uint32_t getRecordsSplit()
+    {
+        return _split;
+    }
+#endif
+
+#if defined(DRAWPROFILE) || defined(FRAMERECORD)
+    // font of the text to count or record
+    void setFont(const FONTS &font)
+    {
+        _font = &font;
+        if (!framing())
+            Base::setFont(font);
+    }
+#endif
+
+#ifdef FRAMERECORD
+    void setCursor(int16_t x, int16_t y)
+    {
+        _cursorX = x;
+        _cursorY = y;
+        if (!framing())
+            Base::setCursor(x, y);
+    }
+
+    void getCursor(int16_t *x, int16_t *y)
+    {
+        if (!framing())
+            return Base::getCursor(x, y);
+        *x = _cursorX;
+        *y = _cursorY;
+    }
+
+    void setTextColor(uint16_t color)
+    {
+        _textColor = color;
+        if (!framing())
+            Base::setTextColor(color);
+    }
+
+    void setTextColor(uint16_t color, uint16_t background)
+    {
+        _textColor = color;
+        if (!framing())
+            Base::setTextColor(color, background);
+    }
+
+    void setTextWrap(bool wrap)
+    {
+        _wrap = wrap;
+        if (!framing())
+            Base::setTextWrap(wrap);
+    }
+
+    // widest line, like the library
+    uint16_t strPixelLen(const char *text)
+    {
+        if (!framing())
+            return Base::strPixelLen(text);
+        if (text == NULL || _font == NULL)
+            return 0;
+
+        uint16_t length = 0, longest = 0;
+        for (; *text; text++)
+        {
+            if (*text == '\n')
+            {
+                longest = length > longest ? length : longest;
+                length = 0;
+                continue;
+            }
+
+            uint32_t bitoffset, width, height, delta;
+            int32_t xoffset, yoffset;
+            if (FontBits::glyph(_font, (uint8_t)*text, bitoffset, width, height, xoffset, yoffset, delta) != NULL)
+                length += delta;
+        }
+        return length > longest ? length : longest;
+    }
+
+    // nothing to read while recording (LineChart scrolls the framebuffer only when it draws to it)
+    uint16_t *getFrameBuffer()
+    {
+        return framing() ? NULL : Base::getFrameBuffer();
+    }
+#endif
+
+    // sends the list, then the framebuffer if one is used
+    void updateScreen()
+    {
+        send();
+        Base::updateScreen();
+    }
+
+    void useFrameBuffer(bool enable)
+    {
+        send();
+        _frameBuffer = enable;
+        Base::useFrameBuffer(enable);
+    }
+
+    void setClipRect(int16_t x, int16_t y, int16_t w, int16_t h)
+    {
+        _clipped = true;
+        _clip = {x, y, w, h, 0};
+        if (!framing())
+            Base::setClipRect(x, y, w, h);
+    }
+
+    void setClipRect()
+    {
+        _clipped = false;
+        if (!framing())
+            Base::setClipRect();
+    }
+
+    // ---------------------------------------------------------------- recorded
+
+    void fillScreen(uint16_t color)
+    {
+        if (!intercepting())
+            return Base::fillScreen(color);
+        record(0, 0, width(), height(), color);
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+    {
+        if (!intercepting())
+            return Base::fillRect(x, y, w, h, color);
+        record(x, y, w, h, color);
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color)
+    {
+        if (!intercepting())
+            return Base::drawPixel(x, y, color);
+        record(x, y, 1, 1, color);
+    }
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+    {
+        if (!intercepting())
+            return Base::drawFastHLine(x, y, w, color);
+        record(x, y, w, 1, color);
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+    {
+        if (!intercepting())
+            return Base::drawFastVLine(x, y, h, color);
+        record(x, y, 1, h, color);
+    }
+
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+    {
+        if (!intercepting())
+            return Base::drawRect(x, y, w, h, color);
+        record(x, y, w, 1, color);
+        record(x, y + h - 1, w, 1, color);
+        record(x, y, 1, h, color);
+        record(x + w - 1, y, 1, h, color);
+    }
+
+    // the runs of the library's line
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+    {
+        if (!intercepting())
+            return Base::drawLine(x0, y0, x1, y1, color);
+
+        if (y0 == y1)
+        {
+            int16_t x = x0 < x1 ? x0 : x1;
+            record(x, y0, abs(x1 - x0) + 1, 1, color);
+            return;
+        }
+        if (x0 == x1)
+        {
+            int16_t y = y0 < y1 ? y0 : y1;
+            record(x0, y, 1, abs(y1 - y0) + 1, color);
+            return;
+        }
+
+        bool steep = abs(y1 - y0) > abs(x1 - x0);
+        if (steep)
+        {
+            swap(x0, y0);
+            swap(x1, y1);
+        }
+        if (x0 > x1)
+        {
+            swap(x0, x1);
+            swap(y0, y1);
+        }
+
+        int16_t dx = x1 - x0;
+        int16_t dy = abs(y1 - y0);
+        int16_t err = dx / 2;
+        int16_t ystep = y0 < y1 ? 1 : -1;
+        int16_t xbegin = x0;
+
+        for (; x0 <= x1; x0++)
+        {
+            err -= dy;
+            if (err < 0)
+            {
+                run(steep, xbegin, y0, x0 - xbegin + 1, color);
+                xbegin = x0 + 1;
+                y0 += ystep;
+                err += dx;
+            }
+        }
+        if (x0 > xbegin + 1)
+            run(steep, xbegin, y0, x0 - xbegin, color);
+    }
+
+    void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+    {
+        if (!intercepting())
+            return Base::drawCircle(x0, y0, r, color);
+        record(x0, y0 + r, 1, 1, color);
+        record(x0, y0 - r, 1, 1, color);
+        record(x0 + r, y0, 1, 1, color);
+        record(x0 - r, y0, 1, 1, color);
+        circleHelper(x0, y0, r, 0x0F, color);
+    }
+
+    void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, uint16_t color)
+    {
+        if (!intercepting())
+            return Base::drawCircleHelper(x0, y0, r, corners, color);
+        circleHelper(x0, y0, r, corners, color);
+    }
+
+    void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+    {
+        if (!intercepting())
+            return Base::fillCircle(x0, y0, r, color);
+        record(x0, y0 - r, 1, 2 * r + 1, color);
+        fillCircleHelper(x0, y0, r, 3, 0, color);
+    }
+
+    void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
+    {
+        if (!intercepting())
+            return Base::drawRoundRect(x, y, w, h, r, color);
+        record(x + r, y, w - 2 * r, 1, color);
+        record(x + r, y + h - 1, w - 2 * r, 1, color);
+        record(x, y + r, 1, h - 2 * r, color);
+        record(x + w - 1, y + r, 1, h - 2 * r, color);
+        circleHelper(x + r, y + r, r, 1, color);
+        circleHelper(x + w - r - 1, y + r, r, 2, color);
+        circleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+        circleHelper(x + r, y + h - r - 1, r, 8, color);
+    }
+
+    void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
+    {
+        if (!intercepting())
+            return Base::fillRoundRect(x, y, w, h, r, color);
+        record(x + r, y, w - 2 * r, h, color);
+        fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
+        fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+    }
+
+    void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color)
+    {
+        if (!intercepting())
+            return Base::fillTriangle(x0, y0, x1, y1, x2, y2, color);
+
+        // sorted by y
+        if (y0 > y1)
+        {
+            swap(y0, y1);
+            swap(x0, x1);
+        }
+        if (y1 > y2)
+        {
+            swap(y2, y1);
+            swap(x2, x1);
+        }
+        if (y0 > y1)
+        {
+            swap(y0, y1);
+            swap(x0, x1);
+        }
+
+        if (y0 == y2)
+        {
+            int16_t a = x0, b = x0;
+            if (x1 < a)
+                a = x1;
+            else if (x1 > b)
+                b = x1;
+            if (x2 < a)
+                a = x2;
+            else if (x2 > b)
+                b = x2;
+            record(a, y0, b - a + 1, 1, color);
+            return;
+        }
+
+        int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0, dx12 = x2 - x1, dy12 = y2 - y1;
+        int32_t sa = 0, sb = 0;
+        int16_t y = y0;
+        int16_t last = y1 == y2 ? y1 : y1 - 1;
+
+        for (; y <= last; y++)
+        {
+            int16_t a = x0 + sa / dy01;
+            int16_t b = x0 + sb / dy02;
+            sa += dx01;
+            sb += dx02;
+            if (a > b)
+                swap(a, b);
+            record(a, y, b - a + 1, 1, color);
+        }
+
+        sa = (int32_t)dx12 * (y - y1);
+        sb = (int32_t)dx02 * (y - y0);
+        for (; y <= y2; y++)
+        {
+            int16_t a = x1 + sa / dy12;
+            int16_t b = x0 + sb / dy02;
+            sa += dx12;
+            sb += dx02;
+            if (a > b)
+                swap(a, b);
+            record(a, y, b - a + 1, 1, color);
+        }
+    }
+
+    // ---------------------------------------------------------------- not recorded, drawn after the list
+
+    void writeRect(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels)
+    {
+#ifdef FRAMERECORD
+        if (framing())
+            return recordPixels(x, y, w, h, pixels);
+#endif
+        send();
+#ifdef DRAWPROFILE
+        if (_profile != NULL)
+            count(x, y, w, h);
+#endif
+        Base::writeRect(x, y, w, h, pixels);
+    }
+
+    size_t write(uint8_t c) override
+    {
+        // the library's write(c) may call write(&c, 1) or the other way round, that goes straight to the library
+        if (_writing)
+            return Base::write(c);
+
+#ifdef FRAMERECORD
+        if (framing())
+        {
+            if (_font == NULL)
+                return 1;
+            if (c == '\n')
+            {
+                _cursorY += _font->line_space;
+                _cursorX = 0;
+            }
+            else
+                recordChar(c);
+            return 1;
+        }
+#endif
+        send();
+#ifdef DRAWPROFILE
+        if (_profile != NULL && _font != NULL)
+            countGlyph(c);
+#endif
+        _writing = true;
+        size_t n = Base::write(c);
+        _writing = false;
+        return n;
+    }
+
+    // char by char through write(c)
+    size_t write(const uint8_t *buffer, size_t size) override
+    {
+        if (_writing)
+            return libraryWrite<Base>(this, buffer, size, 0);
+
+        size_t n = 0;
+        for (size_t i = 0; i < size; i++)
+            n += write(buffer[i]);
+        return n;
+    }
+
+private:
+    DisplayOp *_ops = NULL;
+    uint16_t _capacity = 0;
+    uint16_t _count = 0;
+    bool _frameBuffer = false;
+    bool _clipped = false;
+    DisplayOp _clip; // color unused
+    uint32_t _recorded = 0;
+    uint32_t _sent = 0;
+    bool _writing = false; // in write() of the library
+#ifdef DRAWPROFILE
+    DrawProfile *_profile = NULL;
+#endif
+#if defined(DRAWPROFILE) || defined(FRAMERECORD)
+    const FONTS *_font = NULL;
+#endif
+#ifdef FRAMERECORD
+    FramePipe *_pipe = NULL;
+    FrameRecord *_frame = NULL; // record being filled
+    void (*_wait)(void *) = NULL;
+    void *_waitContext = NULL;
+    uint32_t _split = 0;
+    int16_t _cursorX = 0;
+    int16_t _cursorY = 0;
+    uint16_t _textColor = 0xFFFF;
+    bool _wrap = true;
+#endif
+
+    static void swap(int16_t &a, int16_t &b)
+    {
+        int16_t t = a;
+        a = b;
+        b = t;
+    }
+
+    // write(buffer, size) of the library, that of Print if the library has none
+    template <class Library>
+    static auto libraryWrite(Library *library, const uint8_t *buffer, size_t size, int) -> decltype(library->Library::write(buffer, size))
+    {
+        return library->Library::write(buffer, size);
+    }
+
+    template <class Library>
+    static size_t libraryWrite(Library *library, const uint8_t *buffer, size_t size, long)
+    {
+        return library->Print::write(buffer, size);
+    }
+
+    bool recording()
+    {
+        return _ops != NULL && !_frameBuffer;
+    }
+
+    // between record() and endFrame()
+    bool framing()
+    {
+#ifdef FRAMERECORD
+        return _pipe != NULL;
+#else
+        return false;
+#endif
+    }
+
+    // shapes are split into rectangles (recorded or counted), else drawn by the library
+    bool intercepting()
+    {
+#ifdef DRAWPROFILE
+        if (_profile != NULL)
+            return true;
+#endif
+        return recording() || framing();
+    }
+
+    // x, y of a flat line, swapped back for steep lines
+    void run(bool steep, int16_t x, int16_t y, int16_t length, uint16_t color)
+    {
+        if (steep)
+            record(y, x, 1, length, color);
+        else
+            record(x, y, length, 1, color);
+    }
+
+    void circleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, uint16_t color)
+    {
+        int16_t f = 1 - r, ddFx = 1, ddFy = -2 * r, x = 0, y = r;
+        while (x < y)
+        {
+            if (f >= 0)
+            {
+                y--;
+                ddFy += 2;
+                f += ddFy;
+            }
+            x++;
+            ddFx += 2;
+            f += ddFx;
+
+            if (corners & 0x4)
+            {
+                record(x0 + x, y0 + y, 1, 1, color);
+                record(x0 + y, y0 + x, 1, 1, color);
+            }
+            if (corners & 0x2)
+            {
+                record(x0 + x, y0 - y, 1, 1, color);
+                record(x0 + y, y0 - x, 1, 1, color);
+            }
+            if (corners & 0x8)
+            {
+                record(x0 - y, y0 + x, 1, 1, color);
+                record(x0 - x, y0 + y, 1, 1, color);
+            }
+            if (corners & 0x1)
+            {
+                record(x0 - y, y0 - x, 1, 1, color);
+                record(x0 - x, y0 - y, 1, 1, color);
+            }
+        }
+    }
+
+    void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners, int16_t delta, uint16_t color)
+    {
+        int16_t f = 1 - r, ddFx = 1, ddFy = -2 * r, x = 0, y = r;
+        while (x < y)
+        {
+            if (f >= 0)
+            {
+                y--;
+                ddFy += 2;
+                f += ddFy;
+            }
+            x++;
+            ddFx += 2;
+            f += ddFx;
+
+            if (corners & 0x1)
+            {
+                record(x0 + x, y0 - y, 1, 2 * y + 1 + delta, color);
+                record(x0 + y, y0 - x, 1, 2 * x + 1 + delta, color);
+            }
+            if (corners & 0x2)
+            {
+                record(x0 - x, y0 - y, 1, 2 * y + 1 + delta, color);
+                record(x0 - y, y0 - x, 1, 2 * x + 1 + delta, color);
+            }
+        }
+    }
+
+    // x1, y1, x2, y2 cut to the clip rect and the screen, false if nothing is left
+    bool clip(int16_t &x1, int16_t &y1, int16_t &x2, int16_t &y2)
+    {
+        int16_t cx1 = 0, cy1 = 0, cx2 = width(), cy2 = height();
+        if (_clipped)
+        {
+            cx1 = _clip.x > cx1 ? _clip.x : cx1;
+            cy1 = _clip.y > cy1 ? _clip.y : cy1;
+            cx2 = _clip.x + _clip.w < cx2 ? _clip.x + _clip.w : cx2;
+            cy2 = _clip.y + _clip.h < cy2 ? _clip.y + _clip.h : cy2;
+        }
+        x1 = x1 > cx1 ? x1 : cx1;
+        y1 = y1 > cy1 ? y1 : cy1;
+        x2 = x2 < cx2 ? x2 : cx2;
+        y2 = y2 < cy2 ? y2 : cy2;
+        return x1 < x2 && y1 < y2;
+    }
+
+    // adds the part of the rectangle in the clip rect and on the screen
+    void record(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+    {
+        int16_t x1 = x, y1 = y, x2 = x + w, y2 = y + h;
+        if (!clip(x1, y1, x2, y2))
+            return;
+
+#ifdef FRAMERECORD
+        if (framing())
+        {
+            FrameRecord *r = current();
+            r->ops[r->count++] = {x1, y1, (int16_t)(x2 - x1), (int16_t)(y2 - y1), color, FRAMERECT};
+            return;
+        }
+#endif
+
+#ifdef DRAWPROFILE
+        if (_profile != NULL)
+            _profile->add(x1, y1, x2 - x1, y2 - y1);
+        if (!recording())
+        {
+            Base::fillRect(x1, y1, x2 - x1, y2 - y1, color);
+            return;
+        }
+#endif
+
+        if (_count == _capacity)
+        {
+            optimize();
+            if (_count > _capacity / 2)
+                send();
+        }
+
+        _ops[_count++] = {x1, y1, (int16_t)(x2 - x1), (int16_t)(y2 - y1), color};
+        _recorded++;
+    }
+
+#ifdef DRAWPROFILE
+    void count(int16_t x, int16_t y, int16_t w, int16_t h)
+    {
+        int16_t x1 = x, y1 = y, x2 = x + w, y2 = y + h;
+        if (clip(x1, y1, x2, y2))
+            _profile->add(x1, y1, x2 - x1, y2 - y1);
+    }
+
+    // set pixels of the glyph of c at the cursor, in runs
+    void countGlyph(uint8_t c)
+    {
+        uint32_t bitoffset, width, height, delta;
+        int32_t xoffset, yoffset;
+        const uint8_t *data = FontBits::glyph(_font, c, bitoffset, width, height, xoffset, yoffset, delta);
+        if (data == NULL || _font->version != 1)
+            return;
+
+        int16_t cursorX, cursorY;
+        Base::getCursor(&cursorX, &cursorY);
+        glyphRuns(data, bitoffset, width, height, cursorX + xoffset, cursorY + _font->cap_height - height - yoffset);
+    }
+#endif
+
+#if defined(DRAWPROFILE) || defined(FRAMERECORD)
+    // set pixels of a glyph at gx, gy, in runs: recorded in the text color or counted
+    void glyphRuns(const uint8_t *data, uint32_t bitoffset, uint32_t width, uint32_t height, int16_t gx, int16_t gy)
+    {
+        uint32_t row = 0;
+        while (row < height)
+        {
+            uint32_t repeat = 1;
+            if (FontBits::fetchbit(data, bitoffset++))
+            {
+                repeat = FontBits::fetchbits_unsigned(data, bitoffset, 3) + 2;
+                bitoffset += 3;
+            }
+            if (repeat > height - row)
+                repeat = height - row;
+
+            for (uint32_t col = 0; col < width; col++)
+            {
+                if (!FontBits::fetchbit(data, bitoffset + col))
+                    continue;
+                uint32_t end = col;
+                while (end + 1 < width && FontBits::fetchbit(data, bitoffset + end + 1))
+                    end++;
+#ifdef FRAMERECORD
+                record(gx + col, gy + row, end - col + 1, repeat, _textColor);
+#else
+                count(gx + col, gy + row, end - col + 1, repeat);
+#endif
+                col = end;
+            }
+            bitoffset += width;
+            row += repeat;
+        }
+    }
+#endif
+
+#ifdef FRAMERECORD
+    // record with a free op, the full one is handed over as a part of the frame
+    FrameRecord *current()
+    {
+        if (_frame != NULL && _frame->count == _frame->capacity)
+            handOver();
+        while (_frame == NULL && (_frame = _pipe->next()) == NULL)
+            _wait(_waitContext);
+        return _frame;
+    }
+
+    void handOver()
+    {
+        _pipe->publish();
+        _frame = NULL;
+        _split++;
+    }
+
+    // the visible part of the pixels is copied, in rows or parts of rows where the record is short
+    void recordPixels(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels)
+    {
+        int16_t x1 = x, y1 = y, x2 = x + w, y2 = y + h;
+        if (!clip(x1, y1, x2, y2))
+            return;
+
+        int16_t row = y1, col = x1;
+        while (row < y2)
+        {
+            FrameRecord *r = current();
+            uint32_t free = r->pixelCapacity - r->used;
+            if (free == 0)
+            {
+                // no pixels at all in this record
+                if (r->pixelCapacity == 0)
+                    return;
+                handOver();
+                continue;
+            }
+
+            FrameOp op = {col, row, 0, 1, r->used, FRAMEPIXELS};
+            if (col == x1 && free >= (uint32_t)(x2 - x1))
+            {
+                op.w = x2 - x1;
+                op.h = min((int32_t)(free / op.w), (int32_t)(y2 - row));
+                row += op.h;
+            }
+            else
+            {
+                op.w = min((int32_t)free, (int32_t)(x2 - col));
+                col += op.w;
+                if (col == x2)
+                {
+                    col = x1;
+                    row++;
+                }
+            }
+
+            for (int16_t line = 0; line < op.h; line++)
+                memcpy(r->pixels + r->used + (uint32_t)line * op.w, pixels + (int32_t)(op.y + line - y) * w + (op.x - x), op.w * sizeof(uint16_t));
+            r->used += (uint32_t)op.w * op.h;
+            r->ops[r->count++] = op;
+        }
+    }
+
+    // like drawFontChar of the ILI9341_t3n libs with transparent text
+    void recordChar(uint8_t c)
+    {
+        uint32_t bitoffset, width, height, delta;
+        int32_t xoffset, yoffset;
+        const uint8_t *data = FontBits::glyph(_font, c, bitoffset, width, height, xoffset, yoffset, delta);
+        if (data == NULL || _font->version != 1)
+            return;
+
+        if (_cursorX < 0)
+            _cursorX = 0;
+        int32_t originX = _cursorX + xoffset;
+        if (originX < 0)
+        {
+            _cursorX -= xoffset;
+            originX = 0;
+        }
+        if (originX + (int32_t)width > Base::width())
+        {
+            if (!_wrap)
+                return;
+            originX = 0;
+            _cursorX = xoffset >= 0 ? 0 : -xoffset;
+            _cursorY += _font->line_space;
+        }
+        if (_cursorY >= Base::height())
+            return;
+
+        glyphRuns(data, bitoffset, width, height, originX, _cursorY + _font->cap_height - height - yoffset);
+        _cursorX += delta;
+    }
+#endif
+
+    static bool intersects(const DisplayOp &a, const DisplayOp &b)
+    {
+        return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+    }
+
+    // cuts the part of a that b paints over later, if the rest is a rectangle
+    static void cut(DisplayOp &a, const DisplayOp &b)
+    {
+        if (!intersects(a, b))
+            return;
+
+        bool coversW = b.x <= a.x && b.x + b.w >= a.x + a.w;
+        bool coversH = b.y <= a.y && b.y + b.h >= a.y + a.h;
+        if (coversW && coversH)
+        {
+            a.w = 0;
+            return;
+        }
+
+        if (coversW)
+        {
+            if (b.y <= a.y)
+            {
+                a.h -= b.y + b.h - a.y;
+                a.y = b.y + b.h;
+            }
+            else if (b.y + b.h >= a.y + a.h)
+                a.h = b.y - a.y;
+        }
+        else if (coversH)
+        {
+            if (b.x <= a.x)
+            {
+                a.w -= b.x + b.w - a.x;
+                a.x = b.x + b.w;
+            }
+            else if (b.x + b.w >= a.x + a.w)
+                a.w = b.x - a.x;
+        }
+    }
+
+    // a and b make one rectangle
+    static bool merge(DisplayOp &a, const DisplayOp &b)
+    {
+        if (a.color != b.color)
+            return false;
+
+        if (a.y == b.y && a.h == b.h && (a.x + a.w == b.x || b.x + b.w == a.x))
+        {
+            a.x = a.x < b.x ? a.x : b.x;
+            a.w += b.w;
+            return true;
+        }
+        if (a.x == b.x && a.w == b.w && (a.y + a.h == b.y || b.y + b.h == a.y))
+        {
+            a.y = a.y < b.y ? a.y : b.y;
+            a.h += b.h;
+            return true;
+        }
+        return false;
+    }
+
+    void optimize()
+    {
+        // painted over by a later rectangle: dropped or cut
+        for (int32_t i = _count - 2; i >= 0; i--)
+        {
+            for (uint16_t j = i + 1; j < _count && _ops[i].w > 0; j++)
+            {
+                if (_ops[j].w > 0)
+                    cut(_ops[i], _ops[j]);
+            }
+        }
+        compact();
+
+        // by lines, a rectangle only moves before rectangles it does not paint over (or of its color)
+        for (uint16_t i = 1; i < _count; i++)
+        {
+            DisplayOp op = _ops[i];
+            uint16_t j = i;
+            while (j > 0 && (op.y < _ops[j - 1].y || (op.y == _ops[j - 1].y && op.x < _ops[j - 1].x)) &&
+                   (op.color == _ops[j - 1].color || !intersects(op, _ops[j - 1])))
+            {
+                _ops[j] = _ops[j - 1];
+                j--;
+            }
+            _ops[j] = op;
+        }
+
+        // into an earlier rectangle of the same color, if nothing between paints over it
+        for (uint16_t i = 1; i < _count; i++)
+        {
+            for (int32_t j = i - 1; j >= 0; j--)
+            {
+                if (_ops[j].w == 0)
+                    continue;
+                if (merge(_ops[j], _ops[i]))
+                {
+                    _ops[i].w = 0;
+                    break;
+                }
+                if (_ops[j].color != _ops[i].color && intersects(_ops[j], _ops[i]))
+                    break;
+            }
+        }
+        compact();
+    }
+
+    void compact()
+    {
+        uint16_t n = 0;
+        for (uint16_t i = 0; i < _count; i++)
+        {
+            if (_ops[i].w > 0 && _ops[i].h > 0)
+                _ops[n++] = _ops[i];
+        }
+        _count = n;
+    }
+
+    // the ops are clipped already, the clip rect of the caller is set again after them
+    void send()
+    {
+        if (_count == 0)
+            return;
+
+        optimize();
+        Base::setClipRect();
+        for (uint16_t i = 0; i < _count; i++)
+            Base::fillRect(_ops[i].x, _ops[i].y, _ops[i].w, _ops[i].h, _ops[i].color);
+        if (_clipped)
+            Base::setClipRect(_clip.x, _clip.y, _clip.w, _clip.h);
+
+        _sent += _count;
+        _count = 0;
+    }
+};
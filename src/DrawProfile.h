@@ -0,0 +1,205 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Overdraw profile: for every pixel of a frame, how often it was written and which control wrote it last.
+ * The display is declared as DisplayList (see DisplayList.h), which counts the pixels of every shape, text and
+ * image; BUI tells it the control that draws. Meant for a host build or a board with enough RAM (2 bytes per pixel).
+ *
+ *   #define DRAWPROFILE
+ *   #include <ILI9486_t3n.h>
+ *   #include <BUI.h>
+ *
+ *   DisplayList tft(TFT_CS, TFT_DC, TFT_RST, TFT_MOSI, TFT_SCK, TFT_MISO);
+ *   uint8_t counts[480 * 320], owners[480 * 320];
+ *   DrawProfile profile(counts, owners, 480, 320);
+ *   tft.setProfile(&profile);
+ *   ...
+ *   ui.update();
+ *   profile.printTable(Serial);            // pixels written and visible per control and frame
+ *   profile.writeHeatmap("heatmap.ppm");   // host only, or heatmap() into RGB565 pixels
+ *
+ * Owners are the indices of the controls in BUI (order of addControl), PROFILEBACKGROUND is what BUI draws itself.
+ * Text is counted for the ILI9341_t3 font format (like TextCache).
+ */
+
+#if defined(__linux__)
+#include <stdio.h>
+#endif
+
+// owner of the background and everything drawn outside of a control
+#define PROFILEBACKGROUND 0xFF
+
+class DrawProfile
+{
+public:
+    DrawProfile(uint8_t *counts, uint8_t *owners, uint16_t width, uint16_t height)
+    {
+        _counts = counts;
+        _owners = owners;
+        _width = width;
+        _height = height;
+        memset(_counts, 0, (uint32_t)width * height);
+        clear();
+    }
+
+    // starts the totals of printTable() again
+    void clear()
+    {
+        memset(_written, 0, sizeof(_written));
+        memset(_visible, 0, sizeof(_visible));
+        _frames = 0;
+    }
+
+    // the following pixels are written by owner
+    void setOwner(uint8_t owner)
+    {
+        _owner = owner;
+    }
+
+    // pixels written while paused are not counted (BUI sends pixels it counted when they were drawn)
+    void pause(bool paused)
+    {
+        _paused = paused;
+    }
+
+    // w x h pixels at x, y written (on the screen)
+    void add(int16_t x, int16_t y, int16_t w, int16_t h)
+    {
+        if (_paused)
+            return;
+        if (_ended)
+        {
+            memset(_counts, 0, (uint32_t)_width * _height);
+            memset(_frameWritten, 0, sizeof(_frameWritten));
+            _ended = false;
+        }
+
+        for (int16_t row = y; row < y + h; row++)
+        {
+            if (row < 0 || row >= _height)
+                continue;
+            for (int16_t col = x; col < x + w; col++)
+            {
+                if (col < 0 || col >= _width)
+                    continue;
+                uint32_t i = (uint32_t)row * _width + col;
+                if (_counts[i] < 255)
+                    _counts[i]++;
+                _owners[i] = _owner;
+                _frameWritten[_owner]++;
+            }
+        }
+    }
+
+    // called by BUI after a frame was drawn, the pixels of the frame stay until the next frame draws
+    void endFrame()
+    {
+        if (_ended)
+            return;
+
+        memset(_frameVisible, 0, sizeof(_frameVisible));
+        for (uint32_t i = 0; i < (uint32_t)_width * _height; i++)
+        {
+            if (_counts[i] > 0)
+                _frameVisible[_owners[i]]++;
+        }
+
+        for (uint16_t owner = 0; owner < 256; owner++)
+        {
+            _written[owner] += _frameWritten[owner];
+            _visible[owner] += _frameVisible[owner];
+        }
+        _frames++;
+        _ended = true;
+    }
+
+    // writes of the pixel x, y in the last frame (255 = 255 or more) and who wrote it last
+    uint8_t getCount(int16_t x, int16_t y)
+    {
+        return _counts[(uint32_t)y * _width + x];
+    }
+
+    uint8_t getOwner(int16_t x, int16_t y)
+    {
+        return _owners[(uint32_t)y * _width + x];
+    }
+
+    // pixels owner wrote in the last frame and the ones of them still seen
+    uint32_t getWritten(uint8_t owner)
+    {
+        return _frameWritten[owner];
+    }
+
+    uint32_t getVisible(uint8_t owner)
+    {
+        return _frameVisible[owner];
+    }
+
+    // writes per pixel of the last frame as colors: not written dark gray, 1 blue, 2 green, 3 yellow, 4 orange, more red
+    void heatmap(uint16_t *pixels)
+    {
+        for (uint32_t i = 0; i < (uint32_t)_width * _height; i++)
+            pixels[i] = heat(_counts[i]);
+    }
+
+    // per owner and frame since clear(): pixels written, pixels visible at the end of the frame, writes per visible pixel
+    void printTable(Print &out)
+    {
+        out.printf("%d frames\n", (int)_frames);
+        out.println("owner      written    visible  overdraw");
+        for (uint16_t owner = 0; owner < 256; owner++)
+        {
+            if (_written[owner] == 0)
+                continue;
+
+            uint32_t frames = _frames > 0 ? _frames : 1;
+            if (owner == PROFILEBACKGROUND)
+                out.printf("%-8s", "bg");
+            else
+                out.printf("%-8d", owner);
+            out.printf(" %9lu  %9lu  %8.2f\n", (unsigned long)(_written[owner] / frames), (unsigned long)(_visible[owner] / frames),
+                       _visible[owner] > 0 ? (float)_written[owner] / _visible[owner] : 0.0f);
+        }
+    }
+
+#if defined(__linux__)
+    // heatmap of the last frame as binary PPM file
+    bool writeHeatmap(const char *path)
+    {
+        FILE *file = fopen(path, "wb");
+        if (file == NULL)
+            return false;
+
+        fprintf(file, "P6\n%d %d\n255\n", _width, _height);
+        for (uint32_t i = 0; i < (uint32_t)_width * _height; i++)
+        {
+            uint16_t c = heat(_counts[i]);
+            uint8_t rgb[3] = {(uint8_t)((c >> 8) & 0xF8), (uint8_t)((c >> 3) & 0xFC), (uint8_t)(c << 3)};
+            fwrite(rgb, 1, 3, file);
+        }
+        return fclose(file) == 0;
+    }
+#endif
+
+private:
+    uint8_t *_counts;
+    uint8_t *_owners;
+    uint16_t _width;
+    uint16_t _height;
+    uint8_t _owner = PROFILEBACKGROUND;
+    bool _ended = true;
+    bool _paused = false;
+    uint32_t _frameWritten[256] = {};
+    uint32_t _frameVisible[256] = {};
+    uint32_t _written[256];
+    uint32_t _visible[256];
+    uint32_t _frames;
+
+    static uint16_t heat(uint8_t count)
+    {
+        static const uint16_t colors[] = {0x2104, 0x001F, 0x07E0, 0xFFE0, 0xFD20, 0xF800};
+        return colors[count < 5 ? count : 5];
+    }
+};
@@ -0,0 +1,64 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Bit fields and glyphs of the ILI9341_t3 font format, read like drawFontChar of the ILI9341_t3 libs does
+ * (TextCache, DisplayList with DRAWPROFILE).
+ */
+
+class FontBits
+{
+protected:
+    static uint32_t fetchbit(const uint8_t *p, uint32_t index)
+    {
+        return (p[index >> 3] >> (7 - (index & 7))) & 1;
+    }
+
+    static uint32_t fetchbits_unsigned(const uint8_t *p, uint32_t index, uint32_t required)
+    {
+        uint32_t val = 0;
+        while (required--)
+            val = (val << 1) | fetchbit(p, index++);
+        return val;
+    }
+
+    static int32_t fetchbits_signed(const uint8_t *p, uint32_t index, uint32_t required)
+    {
+        uint32_t val = fetchbits_unsigned(p, index, required);
+        if (val & (1 << (required - 1)))
+            return (int32_t)val - (1 << required);
+        return (int32_t)val;
+    }
+
+    // glyph bitmap of c, the bit offset of its first row is returned in bitoffset
+    // (a template, so libs with other fonts compile as long as it is not used)
+    template <class Font>
+    static const uint8_t *glyph(const Font *font, uint8_t c, uint32_t &bitoffset, uint32_t &width, uint32_t &height, int32_t &xoffset, int32_t &yoffset, uint32_t &delta)
+    {
+        uint32_t index;
+        if (c >= font->index1_first && c <= font->index1_last)
+            index = c - font->index1_first;
+        else if (c >= font->index2_first && c <= font->index2_last)
+            index = c - font->index2_first + font->index1_last - font->index1_first + 1;
+        else
+            return NULL;
+
+        const uint8_t *data = font->data + fetchbits_unsigned(font->index, index * font->bits_index, font->bits_index);
+        if (fetchbits_unsigned(data, 0, 3) != 0)
+            return NULL;
+
+        bitoffset = 3;
+        width = fetchbits_unsigned(data, bitoffset, font->bits_width);
+        bitoffset += font->bits_width;
+        height = fetchbits_unsigned(data, bitoffset, font->bits_height);
+        bitoffset += font->bits_height;
+        xoffset = fetchbits_signed(data, bitoffset, font->bits_xoffset);
+        bitoffset += font->bits_xoffset;
+        yoffset = fetchbits_signed(data, bitoffset, font->bits_yoffset);
+        bitoffset += font->bits_yoffset;
+        delta = fetchbits_unsigned(data, bitoffset, font->bits_delta);
+        bitoffset += font->bits_delta;
+        return data;
+    }
+};
@@ -0,0 +1,262 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Sends only the pixels of the framebuffer that changed since the last frame, instead of the whole framebuffer.
+ * The frame is compared with a copy of what the display shows (exact, 2 bytes per pixel) or with hashes of
+ * DIFFSEGMENT pixels of every line (4 bytes per DIFFSEGMENT pixels). Changed pixels of a line are sent as spans,
+ * one address window each; changed whole lines one after another are sent at once.
+ *
+ *   uint16_t shadow[480 * 320];                       // or: uint32_t hashes[DIFFHASHES(480, 320)];
+ *   FrameDiff frameDiff(shadow, 480, 320);            //     FrameDiff frameDiff(hashes, 480, 320);
+ *   ui.setFrameDiff(&frameDiff);
+ *
+ * It works with any redraw (whole screen or enableRedrawOnChange) and finds changes the tiles do not know about,
+ * like a control repainted with the same pixels. Frames are sent without DMA then (enableAsyncUpdate is ignored).
+ * With hashes, a change that keeps the hash of its segment is missed (about 1 in 4 billion); invalidate() sends
+ * the whole next frame.
+ */
+
+// pixels per hash of a line, the spans of the hash mode are multiples of it
+#ifndef DIFFSEGMENT
+#define DIFFSEGMENT 32
+#endif
+
+// unchanged pixels between two changes of a line that are sent rather than starting a new span
+// (a new address window costs about as much as 6 pixels on the SPI bus, plus the start of a transfer)
+#ifndef DIFFGAP
+#define DIFFGAP 16
+#endif
+
+// entries of the hashes of a width x height frame
+#define DIFFHASHES(width, height) ((((width) + DIFFSEGMENT - 1) / DIFFSEGMENT) * (height))
+
+class FrameDiff
+{
+public:
+    // exact: shadow is a copy of the screen, width * height pixels
+    FrameDiff(uint16_t *shadow, uint16_t width, uint16_t height)
+    {
+        _shadow = shadow;
+        _capacity = (uint32_t)width * height;
+        _width = width;
+        _height = height;
+    }
+
+    // less RAM: hashes has DIFFHASHES(width, height) entries
+    FrameDiff(uint32_t *hashes, uint16_t width, uint16_t height)
+    {
+        _hashes = hashes;
+        _capacity = DIFFHASHES(width, height);
+        _width = width;
+        _height = height;
+    }
+
+    // the next send() sends the whole frame, e.g. after something else was drawn to the display
+    void invalidate()
+    {
+        _valid = false;
+    }
+
+    // sends the changed pixels of frame (tft->width() * tft->height() pixels, the framebuffer of tft)
+    void send(TFTLIB *tft, const uint16_t *frame)
+    {
+        // rotated: the lines of the frame changed
+        if (tft->width() != _width || tft->height() != _height)
+        {
+            _width = tft->width();
+            _height = tft->height();
+            _valid = false;
+        }
+
+        uint32_t needed = _shadow != NULL ? (uint32_t)_width * _height : DIFFHASHES(_width, _height);
+        if (!_valid || needed > _capacity)
+        {
+            tft->updateScreen();
+            _pixelsSent += (uint32_t)_width * _height;
+            _spansSent++;
+            if (needed <= _capacity)
+            {
+                store(frame);
+                _valid = true;
+            }
+            return;
+        }
+
+        tft->useFrameBuffer(false);
+        _runH = 0;
+        for (uint16_t y = 0; y < _height; y++)
+        {
+            if (_shadow != NULL)
+                diffLine(tft, frame, y);
+            else
+                hashLine(tft, frame, y);
+        }
+        sendRun(tft, frame);
+        tft->useFrameBuffer(true);
+    }
+
+    // pixels and address windows sent since the start, to compare with the whole frames
+    uint32_t getPixelsSent()
+    {
+        return _pixelsSent;
+    }
+
+    uint32_t getSpansSent()
+    {
+        return _spansSent;
+    }
+
+private:
+    uint16_t *_shadow = NULL;
+    uint32_t *_hashes = NULL;
+    uint32_t _capacity;
+    uint16_t _width;
+    uint16_t _height;
+    bool _valid = false;
+    uint32_t _pixelsSent = 0;
+    uint32_t _spansSent = 0;
+    uint16_t _runY = 0; // changed whole lines not sent yet
+    uint16_t _runH = 0;
+
+    void store(const uint16_t *frame)
+    {
+        if (_shadow != NULL)
+        {
+            memcpy(_shadow, frame, (uint32_t)_width * _height * sizeof(uint16_t));
+            return;
+        }
+
+        uint16_t segments = (_width + DIFFSEGMENT - 1) / DIFFSEGMENT;
+        for (uint16_t y = 0; y < _height; y++)
+        {
+            const uint16_t *line = frame + (uint32_t)y * _width;
+            for (uint16_t s = 0; s < segments; s++)
+                _hashes[(uint32_t)y * segments + s] = hash(line + s * DIFFSEGMENT, segmentWidth(s));
+        }
+    }
+
+    // changes of line y against the shadow, 2 pixels per compare
+    void diffLine(TFTLIB *tft, const uint16_t *frame, uint16_t y)
+    {
+        const uint16_t *line = frame + (uint32_t)y * _width;
+        uint16_t *shadow = _shadow + (uint32_t)y * _width;
+        uint16_t words = _width / 2;
+        int32_t first = -1, last = -1; // words of the span
+
+        for (uint16_t i = 0; i < words; i++)
+        {
+            uint32_t a, b;
+            memcpy(&a, line + 2 * i, 4);
+            memcpy(&b, shadow + 2 * i, 4);
+            if (a == b)
+                continue;
+
+            if (first >= 0 && (i - last - 1) * 2 > DIFFGAP)
+            {
+                span(tft, frame, first * 2, (last - first + 1) * 2, y);
+                first = -1;
+            }
+            if (first < 0)
+                first = i;
+            last = i;
+        }
+
+        // pixels of the last span, with the last pixel of an odd width
+        int32_t x1 = first >= 0 ? first * 2 : -1;
+        int32_t x2 = (last + 1) * 2;
+        if ((_width & 1) && line[_width - 1] != shadow[_width - 1])
+        {
+            if (x1 < 0)
+                x1 = _width - 1;
+            x2 = _width;
+        }
+
+        if (x1 >= 0)
+            span(tft, frame, x1, x2 - x1, y);
+    }
+
+    // changes of line y against the hashes of its segments, neighbouring changed segments are one span
+    void hashLine(TFTLIB *tft, const uint16_t *frame, uint16_t y)
+    {
+        const uint16_t *line = frame + (uint32_t)y * _width;
+        uint16_t segments = (_width + DIFFSEGMENT - 1) / DIFFSEGMENT;
+        uint32_t *hashes = _hashes + (uint32_t)y * segments;
+        int16_t first = -1;
+
+        for (uint16_t s = 0; s < segments; s++)
+        {
+            uint32_t h = hash(line + s * DIFFSEGMENT, segmentWidth(s));
+            if (h != hashes[s])
+            {
+                hashes[s] = h;
+                if (first < 0)
+                    first = s;
+            }
+            else if (first >= 0)
+            {
+                span(tft, frame, first * DIFFSEGMENT, (s - first) * DIFFSEGMENT, y);
+                first = -1;
+            }
+        }
+        if (first >= 0)
+            span(tft, frame, first * DIFFSEGMENT, _width - first * DIFFSEGMENT, y);
+    }
+
+    uint16_t segmentWidth(uint16_t segment)
+    {
+        uint16_t left = _width - segment * DIFFSEGMENT;
+        return left < DIFFSEGMENT ? left : DIFFSEGMENT;
+    }
+
+    // FNV-1a over 2 pixels at once
+    static uint32_t hash(const uint16_t *pixels, uint16_t n)
+    {
+        uint32_t h = 2166136261UL;
+        uint16_t i = 0;
+        for (; i + 2 <= n; i += 2)
+        {
+            uint32_t v;
+            memcpy(&v, pixels + i, 4);
+            h = (h ^ v) * 16777619UL;
+        }
+        if (i < n)
+            h = (h ^ pixels[i]) * 16777619UL;
+        return h;
+    }
+
+    // w changed pixels at x, y: whole lines are collected, the rest is sent at once
+    void span(TFTLIB *tft, const uint16_t *frame, uint16_t x, uint16_t w, uint16_t y)
+    {
+        if (_shadow != NULL)
+            memcpy(_shadow + (uint32_t)y * _width + x, frame + (uint32_t)y * _width + x, w * sizeof(uint16_t));
+
+        if (x == 0 && w == _width)
+        {
+            if (_runH > 0 && _runY + _runH == y)
+            {
+                _runH++;
+                return;
+            }
+            sendRun(tft, frame);
+            _runY = y;
+            _runH = 1;
+            return;
+        }
+
+        tft->writeRect(x, y, w, 1, frame + (uint32_t)y * _width + x);
+        _pixelsSent += w;
+        _spansSent++;
+    }
+
+    void sendRun(TFTLIB *tft, const uint16_t *frame)
+    {
+        if (_runH == 0)
+            return;
+        tft->writeRect(0, _runY, _width, _runH, frame + (uint32_t)_runY * _width);
+        _pixelsSent += (uint32_t)_width * _runH;
+        _spansSent++;
+        _runH = 0;
+    }
+};
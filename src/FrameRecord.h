@@ -0,0 +1,114 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Frames as records for the pipelined BUI (PIPELINE): while the controls draw, the DisplayList records every
+ * shape, char and image as rectangles of one color or of pixels, already clipped. A record does not change once it
+ * is handed over, so the render task draws it into the framebuffer while the controls record the next frame.
+ *
+ *   FrameOp ops[2][600];      // 16 bytes each
+ *   uint16_t pixels[2][8192]; // copies of the pixels of writeRect (images, NumPad keys, cached texts)
+ *   FrameRecord records[2] = {{ops[0], 600, pixels[0], 8192}, {ops[1], 600, pixels[1], 8192}};
+ *
+ * A frame that does not fit into one record is handed over in parts, the render task sends the frame after the
+ * last part.
+ */
+
+// FrameOp kinds
+#define FRAMERECT 0
+#define FRAMEPIXELS 1
+
+// a rectangle on the screen, clipped when it was recorded
+struct FrameOp
+{
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+    uint32_t value; // FRAMERECT: color, FRAMEPIXELS: index of the first pixel in FrameRecord::pixels
+    uint8_t kind;
+};
+
+struct FrameRecord
+{
+    FrameOp *ops;
+    uint16_t capacity;
+    uint16_t *pixels;
+    uint32_t pixelCapacity;
+
+    uint16_t count; // ops recorded
+    uint32_t used;  // pixels recorded
+    bool last;      // the frame ends with this record
+
+    FrameRecord(FrameOp *ops = NULL, uint16_t capacity = 0, uint16_t *pixels = NULL, uint32_t pixelCapacity = 0)
+        : ops(ops), capacity(capacity), pixels(pixels), pixelCapacity(pixelCapacity), count(0), used(0), last(false)
+    {
+    }
+
+    void clear()
+    {
+        count = 0;
+        used = 0;
+        last = false;
+    }
+};
+
+// hands the records from the recording task to the render task, lock-free like UpdateQueue:
+// one producer (BUI::render) and one consumer (the render task)
+class FramePipe
+{
+public:
+    void begin(FrameRecord *records, uint8_t count)
+    {
+        _records = records;
+        _count = count;
+        _head = 0;
+        _tail = 0;
+    }
+
+    // producer: the next record to fill, cleared, NULL while all are handed over
+    FrameRecord *next()
+    {
+        // the record is replayed before it is given back
+        uint16_t tail = __atomic_load_n(&_tail, __ATOMIC_ACQUIRE);
+        if ((_head + 2 * _count - tail) % (2 * _count) >= _count)
+            return NULL;
+        FrameRecord *r = &_records[_head % _count];
+        r->clear();
+        return r;
+    }
+
+    // producer: hands the record of next() over
+    void publish()
+    {
+        // the record is written before it is published
+        __atomic_store_n(&_head, (uint16_t)((_head + 1) % (2 * _count)), __ATOMIC_RELEASE);
+    }
+
+    // consumer: oldest handed over record or NULL, give it back with pop()
+    FrameRecord *front()
+    {
+        if (_tail == __atomic_load_n(&_head, __ATOMIC_ACQUIRE))
+            return NULL;
+        return &_records[_tail % _count];
+    }
+
+    void pop()
+    {
+        __atomic_store_n(&_tail, (uint16_t)((_tail + 1) % (2 * _count)), __ATOMIC_RELEASE);
+    }
+
+    // everything handed over is replayed
+    bool empty()
+    {
+        return __atomic_load_n(&_tail, __ATOMIC_ACQUIRE) == __atomic_load_n(&_head, __ATOMIC_ACQUIRE);
+    }
+
+private:
+    FrameRecord *_records = NULL;
+    uint8_t _count = 0;
+    // 0 .. 2 * _count - 1, so a full pipe differs from an empty one
+    uint16_t _head = 0; // written by the producer only
+    uint16_t _tail = 0; // written by the consumer only
+};
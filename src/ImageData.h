@@ -0,0 +1,543 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Compressed image formats for Image and Button.
+ * Images are decoded pixel by pixel in small chunks (IMAGECHUNK) and written row by row,
+ * so there is never a full decode buffer in RAM.
+ * Use tools/img2bui.py to convert PNG or BMP files into these formats.
+ */
+
+// image formats
+#define IMG_RAW 0     // uncompressed RGB565, data is const uint16_t *
+#define IMG_RLE 1     // run-length encoded RGB565 (or 8 bit indices if a palette is set)
+#define IMG_INDEXED 2 // 1, 2, 4 or 8 bpp indices into an RGB565 palette, every row starts on a byte
+
+// pixels decoded per writeRect (RAM used on the stack while drawing)
+#ifndef IMAGECHUNK
+#define IMAGECHUNK 64
+#endif
+
+// bytes read from an ImageSource at once (RAM used on the stack while drawing)
+#ifndef IMAGEREADBUFFER
+#define IMAGEREADBUFFER 512
+#endif
+
+// maximum tiles of an ImageCache
+#ifndef IMAGECACHETILES
+#define IMAGECACHETILES 64
+#endif
+
+/*
+ * Images that do not fit in memory are read through an ImageSource (file on SD, file on the host).
+ * read() fills buf with up to len bytes from offset and returns how many were read.
+ * Sources that are memory mapped return the mapping in mapped(), so they are drawn without copying.
+ */
+class ImageSource
+{
+public:
+    virtual uint32_t read(uint32_t offset, uint8_t *buf, uint32_t len) = 0;
+
+    virtual const uint8_t *mapped()
+    {
+        return NULL;
+    }
+};
+
+/*
+ * RLE packets: one control byte followed by pixel values
+ *   control & 0x80: run, the next value is repeated (control & 0x7F) + 1 times
+ *   else:           literal, (control + 1) values follow
+ * A value is a little endian RGB565 word, or one index byte if the image has a palette.
+ * Packets may span row boundaries.
+ *
+ * If source is set, the pixel data is read from source starting at dataOffset, instead of data.
+ */
+struct ImageData
+{
+    uint16_t width;
+    uint16_t height;
+    uint8_t format;
+    uint8_t bpp; // bits per index for IMG_INDEXED
+    const uint16_t *palette;
+    const void *data;
+    ImageSource *source;
+    uint32_t dataOffset;
+};
+
+class ImageDecoder
+{
+public:
+    void begin(const ImageData *image)
+    {
+        _image = image;
+        _col = 0;
+        _bit = 0;
+        _count = 0;
+        _isRun = false;
+
+        if (image->source != NULL)
+        {
+            _readOffset = image->dataOffset;
+            refill();
+        }
+        else
+        {
+            // memory images never reach _end
+            _src = (const uint8_t *)image->data;
+            _end = NULL;
+        }
+    }
+
+    // decode the next count pixels (in rows from top left) to out
+    void decode(uint16_t *out, uint16_t count)
+    {
+        switch (_image->format)
+        {
+        case IMG_RAW:
+            decodeRaw(out, count);
+            break;
+        case IMG_RLE:
+            decodeRLE(out, count);
+            break;
+        case IMG_INDEXED:
+            decodeIndexed(out, count);
+            break;
+        }
+    }
+
+    // skip the next count pixels
+    void skip(uint32_t count)
+    {
+        uint16_t buf[IMAGECHUNK];
+
+        if (_image->format == IMG_RAW && _image->source == NULL)
+        {
+            _src += count * 2;
+            return;
+        }
+
+        while (count > 0)
+        {
+            uint16_t n = count > IMAGECHUNK ? IMAGECHUNK : count;
+            decode(buf, n);
+            count -= n;
+        }
+    }
+
+private:
+    const ImageData *_image = NULL;
+    const uint8_t *_src = NULL;
+    const uint8_t *_end = NULL;
+    uint8_t _buf[IMAGEREADBUFFER];
+    uint32_t _readOffset = 0;
+    uint16_t _col = 0;  // column in the current row (indexed)
+    uint8_t _bit = 0;   // bit position in the current byte (indexed)
+    uint8_t _count = 0; // values left in the current packet (rle)
+    bool _isRun = false;
+    uint16_t _runValue = 0;
+
+    void refill()
+    {
+        uint32_t n = _image->source->read(_readOffset, _buf, IMAGEREADBUFFER);
+        _readOffset += n;
+
+        // behind the end of the source, keep decoding zeros
+        if (n == 0)
+        {
+            _buf[0] = 0;
+            n = 1;
+        }
+
+        _src = _buf;
+        _end = _buf + n;
+    }
+
+    // bytes that can be read without refill
+    uint32_t available(uint32_t wanted)
+    {
+        if (_end == NULL)
+            return wanted;
+        if (_src == _end)
+            refill();
+        return (uint32_t)(_end - _src) < wanted ? _end - _src : wanted;
+    }
+
+    inline uint8_t readByte()
+    {
+        if (_src == _end)
+            refill();
+        return *_src++;
+    }
+
+    inline uint16_t readValue()
+    {
+        if (_image->palette != NULL)
+            return _image->palette[readByte()];
+
+        uint16_t value = readByte();
+        return value | (readByte() << 8);
+    }
+
+    void decodeRaw(uint16_t *out, uint16_t count)
+    {
+        uint8_t *dst = (uint8_t *)out;
+        uint32_t bytes = count * 2;
+
+        while (bytes > 0)
+        {
+            uint32_t n = available(bytes);
+            memcpy(dst, _src, n);
+            _src += n;
+            dst += n;
+            bytes -= n;
+        }
+    }
+
+    void decodeRLE(uint16_t *out, uint16_t count)
+    {
+        while (count > 0)
+        {
+            if (_count == 0)
+            {
+                uint8_t control = readByte();
+                _isRun = control & 0x80;
+                _count = (control & 0x7F) + 1;
+                if (_isRun)
+                    _runValue = readValue();
+            }
+
+            uint8_t n = count < _count ? count : _count;
+            _count -= n;
+            count -= n;
+
+            if (_isRun)
+            {
+                uint16_t value = _runValue;
+                while (n--)
+                    *out++ = value;
+            }
+            else
+            {
+                while (n--)
+                    *out++ = readValue();
+            }
+        }
+    }
+
+    void decodeIndexed(uint16_t *out, uint16_t count)
+    {
+        const uint16_t *palette = _image->palette;
+        const uint8_t bpp = _image->bpp;
+        const uint16_t width = _image->width;
+
+        while (count > 0)
+        {
+            // pixels left in this row
+            uint16_t n = width - _col;
+            if (n > count)
+                n = count;
+            count -= n;
+            _col += n;
+
+            if (bpp == 8)
+            {
+                while (n > 0)
+                {
+                    uint16_t m = available(n);
+                    const uint8_t *src = _src;
+                    _src += m;
+                    n -= m;
+                    while (m >= 4)
+                    {
+                        out[0] = palette[src[0]];
+                        out[1] = palette[src[1]];
+                        out[2] = palette[src[2]];
+                        out[3] = palette[src[3]];
+                        out += 4;
+                        src += 4;
+                        m -= 4;
+                    }
+                    while (m--)
+                        *out++ = palette[*src++];
+                }
+            }
+            else
+            {
+                // 1, 2 or 4 bpp, msb first
+                const uint8_t mask = (1 << bpp) - 1;
+                uint8_t bit = _bit;
+
+                // whole bytes at 4 bpp
+                if (bpp == 4 && bit == 0)
+                {
+                    while (n >= 2)
+                    {
+                        uint8_t b = readByte();
+                        out[0] = palette[b >> 4];
+                        out[1] = palette[b & 0x0F];
+                        out += 2;
+                        n -= 2;
+                    }
+                }
+
+                while (n--)
+                {
+                    if (_src == _end)
+                        refill();
+                    *out++ = palette[(*_src >> (8 - bpp - bit)) & mask];
+                    bit += bpp;
+                    if (bit == 8)
+                    {
+                        bit = 0;
+                        _src++;
+                    }
+                }
+                _bit = bit;
+            }
+
+            // rows start on a byte
+            if (_col == width)
+            {
+                _col = 0;
+                if (_bit != 0)
+                {
+                    _bit = 0;
+                    _src++;
+                }
+            }
+        }
+    }
+};
+
+/*
+ * Keeps the last decoded chunks of images, so images read from a slow source are not decoded every frame.
+ * buffer must hold tiles * IMAGECHUNK pixels.
+ */
+class ImageCache
+{
+public:
+    ImageCache(uint16_t *buffer, uint8_t tiles)
+    {
+        _buffer = buffer;
+        _tiles = tiles > IMAGECACHETILES ? IMAGECACHETILES : tiles;
+        clear();
+    }
+
+    void clear()
+    {
+        for (uint8_t i = 0; i < _tiles; i++)
+            _keys[i].image = NULL;
+        _next = 0;
+    }
+
+protected:
+    friend class Control;
+
+    // returns the cached count pixels of image starting at pixel, or NULL
+    uint16_t *find(const ImageData *image, uint32_t pixel, uint16_t count)
+    {
+        for (uint8_t i = 0; i < _tiles; i++)
+        {
+            if (_keys[i].image == image && _keys[i].pixel == pixel && _keys[i].count == count)
+                return _buffer + i * IMAGECHUNK;
+        }
+        return NULL;
+    }
+
+    // returns the tile to decode count pixels of image to, replacing the oldest one, NULL without tiles
+    uint16_t *store(const ImageData *image, uint32_t pixel, uint16_t count)
+    {
+        if (_tiles == 0)
+            return NULL;
+        uint8_t i = _next;
+        _next = (_next + 1) % _tiles;
+        _keys[i].image = image;
+        _keys[i].pixel = pixel;
+        _keys[i].count = count;
+        return _buffer + i * IMAGECHUNK;
+    }
+
+private:
+    struct key
+    {
+        const ImageData *image;
+        uint32_t pixel;
+        uint16_t count;
+    };
+    key _keys[IMAGECACHETILES];
+    uint16_t *_buffer;
+    uint8_t _tiles;
+    uint8_t _next;
+};
+
+/*
+ * Image file (.bui, written by tools/img2bui.py --bin) read through an ImageSource.
+ * Only the header and the palette are kept in RAM.
+ *
+ * header (little endian): 'B' 'U' 'I' '1', width (2), height (2), format (1), bpp (1), palette count (2),
+ * palette (count * 2), pixel data
+ */
+class FileImage
+{
+public:
+    ImageData image;
+
+    bool begin(ImageSource *source)
+    {
+        uint8_t header[12];
+
+        image.source = NULL;
+        if (source->read(0, header, 12) != 12 || memcmp(header, "BUI1", 4) != 0)
+            return false;
+
+        image.width = header[4] | (header[5] << 8);
+        image.height = header[6] | (header[7] << 8);
+        image.format = header[8];
+        image.bpp = header[9];
+        image.data = NULL;
+
+        uint16_t paletteCount = header[10] | (header[11] << 8);
+        if (paletteCount > 256 || !valid(image.format, image.bpp, paletteCount))
+            return false;
+
+        if (paletteCount > 0)
+        {
+            uint8_t *bytes = (uint8_t *)_palette;
+            if (source->read(12, bytes, paletteCount * 2) != paletteCount * 2u)
+                return false;
+            for (uint16_t i = 0; i < paletteCount; i++)
+                _palette[i] = bytes[i * 2] | (bytes[i * 2 + 1] << 8);
+            image.palette = _palette;
+        }
+        else
+            image.palette = NULL;
+
+        image.source = source;
+        image.dataOffset = 12 + paletteCount * 2;
+
+        // mapped files are used in place
+        if (source->mapped() != NULL)
+        {
+            image.data = source->mapped() + image.dataOffset;
+            image.source = NULL;
+        }
+        return true;
+    }
+
+    // format and palette a decoder can draw: indexed images need 1, 2, 4 or 8 bpp and a color for every index
+    static bool valid(uint8_t format, uint8_t bpp, uint16_t paletteCount)
+    {
+        if (format > IMG_INDEXED)
+            return false;
+        if (format != IMG_INDEXED)
+            return true;
+        if (bpp != 1 && bpp != 2 && bpp != 4 && bpp != 8)
+            return false;
+        return paletteCount > 0 && paletteCount >= (1 << bpp);
+    }
+
+private:
+    uint16_t _palette[256];
+};
+
+#if defined(__SD_H__)
+// image file on a SD card
+class SDImageSource : public ImageSource
+{
+public:
+    bool open(const char *path)
+    {
+        _file = SD.open(path, FILE_READ);
+        return _file;
+    }
+
+    void close()
+    {
+        _file.close();
+    }
+
+    uint32_t read(uint32_t offset, uint8_t *buf, uint32_t len) override
+    {
+        if (!_file || !_file.seek(offset))
+            return 0;
+        int n = _file.read(buf, len);
+        return n > 0 ? n : 0;
+    }
+
+private:
+    File _file;
+};
+#endif
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// image file on the host, read with pread or memory mapped
+class HostImageSource : public ImageSource
+{
+public:
+    bool open(const char *path, bool mapped = false)
+    {
+        close();
+        _fd = ::open(path, O_RDONLY);
+        if (_fd < 0)
+            return false;
+
+        if (mapped)
+        {
+            struct stat st;
+            if (fstat(_fd, &st) == 0 && st.st_size > 0)
+            {
+                void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, _fd, 0);
+                if (map != MAP_FAILED)
+                {
+                    _map = (const uint8_t *)map;
+                    _size = st.st_size;
+                }
+            }
+        }
+        return true;
+    }
+
+    void close()
+    {
+        if (_map != NULL)
+            munmap((void *)_map, _size);
+        if (_fd >= 0)
+            ::close(_fd);
+        _map = NULL;
+        _fd = -1;
+    }
+
+    const uint8_t *mapped() override
+    {
+        return _map;
+    }
+
+    uint32_t read(uint32_t offset, uint8_t *buf, uint32_t len) override
+    {
+        if (_map != NULL)
+        {
+            if (offset >= _size)
+                return 0;
+            if (len > _size - offset)
+                len = _size - offset;
+            memcpy(buf, _map + offset, len);
+            return len;
+        }
+
+        ssize_t n = pread(_fd, buf, len, offset);
+        return n > 0 ? n : 0;
+    }
+
+private:
+    int _fd = -1;
+    const uint8_t *_map = NULL;
+    uint32_t _size = 0;
+};
+#endif
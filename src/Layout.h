@@ -0,0 +1,353 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Places the controls of a screen instead of pixel constants, so one screen fits 320x240 and 480x320 displays.
+ * A layout puts its items one below the other (LAYOUTVSTACK), side by side (LAYOUTHSTACK), row by row in columns
+ * (LAYOUTGRID) or at the edges of its area (LAYOUTANCHOR). Layouts can be items of layouts:
+ *
+ *   Layout screen(LAYOUTANCHOR);
+ *   Layout page(LAYOUTVSTACK);
+ *   page.add(&lblTitle);
+ *   page.add(&sl1, 0, 24, LAYOUTFILLW);                      // full width, 24 pixels high
+ *   screen.add(&page, 0, 0, LAYOUTLEFT | LAYOUTRIGHT | LAYOUTTOP);
+ *   screen.add(&btnBack, 100, 30, LAYOUTLEFT | LAYOUTBOTTOM);
+ *   screen.padding = 10;
+ *   ui.setLayout(&screen);
+ *
+ * Sizes are measured and the controls are placed once, the result stays in x, y (w, h) of the controls.
+ * BUI arranges again only when the display size or rotation changes; call invalidate() after a change of the
+ * content (e.g. the text of a label without given size), on the layout of the control or any layout above it.
+ */
+
+// items per layout
+#ifndef LAYOUTITEMS
+#define LAYOUTITEMS 12
+#endif
+
+// kinds
+#define LAYOUTVSTACK 0
+#define LAYOUTHSTACK 1
+#define LAYOUTGRID 2
+#define LAYOUTANCHOR 3
+
+// item flags: fill the width or height of the cell (stacks share the space left between the filling items)
+#define LAYOUTFILLW 0x01
+#define LAYOUTFILLH 0x02
+// edges of the area an item of a LAYOUTANCHOR keeps padding pixels to (both = stretched, none = centered)
+#define LAYOUTLEFT 0x10
+#define LAYOUTRIGHT 0x20
+#define LAYOUTTOP 0x40
+#define LAYOUTBOTTOM 0x80
+
+class Layout
+{
+public:
+    uint8_t spacing = 6; // between the items
+    uint8_t padding = 0; // around the items
+    uint8_t columns = 2; // of a LAYOUTGRID
+
+    Layout(uint8_t kind = LAYOUTVSTACK)
+    {
+        _kind = kind;
+    }
+
+    // width, height = w, h of the control like in its constructor, 0 = as it is
+    bool add(Control *control, uint16_t width = 0, uint16_t height = 0, uint8_t flags = 0)
+    {
+        item *i = next();
+        if (i == NULL)
+            return false;
+        i->control = control;
+        i->w = width;
+        i->h = height;
+        i->flags = flags;
+        return true;
+    }
+
+    bool add(Layout *layout, uint16_t width = 0, uint16_t height = 0, uint8_t flags = 0)
+    {
+        item *i = next();
+        if (i == NULL)
+            return false;
+        i->layout = layout;
+        layout->_parent = this;
+        i->w = width;
+        i->h = height;
+        i->flags = flags;
+        return true;
+    }
+
+    void clear()
+    {
+        _count = 0;
+        invalidate();
+    }
+
+    // part of the screen the layout fills (default whole screen)
+    void setArea(const Rect &area)
+    {
+        _area = area;
+        invalidate();
+    }
+
+    // measure and arrange again with the next update, BUI arranges the outermost layout
+    void invalidate()
+    {
+        for (Layout *l = this; l != NULL; l = l->_parent)
+            l->_valid = false;
+    }
+
+    // places the controls if the layout is invalid or the display changed, true if it did
+    bool arrange(TFTLIB *tft)
+    {
+        if (_valid && _screenW == tft->width() && _screenH == tft->height())
+            return false;
+
+        _screenW = tft->width();
+        _screenH = tft->height();
+        measure(tft);
+
+        Rect area = _area;
+        if (area.isEmpty())
+            area = {0, 0, (int16_t)_screenW, (int16_t)_screenH};
+        place(area);
+        _valid = true;
+        return true;
+    }
+
+private:
+    struct item
+    {
+        Control *control;
+        Layout *layout;
+        uint16_t w; // given size
+        uint16_t h;
+        uint8_t flags;
+        int16_t mw; // measured size
+        int16_t mh;
+        int16_t ox; // bounds of the control relative to x, y and w, h
+        int16_t oy;
+        int16_t ow;
+        int16_t oh;
+    };
+
+    item _items[LAYOUTITEMS];
+    uint8_t _count = 0;
+    uint8_t _kind;
+    Rect _area = {0, 0, 0, 0};
+    bool _valid = false;
+    Layout *_parent = NULL; // layout this one is an item of
+    uint16_t _screenW = 0;
+    uint16_t _screenH = 0;
+    int16_t _mw = 0; // measured size of all items
+    int16_t _mh = 0;
+
+    item *next()
+    {
+        if (_count >= LAYOUTITEMS)
+            return NULL;
+        item *i = &_items[_count++];
+        memset(i, 0, sizeof(item));
+        invalidate();
+        return i;
+    }
+
+    // measure pass: sizes of the items and of the layout
+    void measure(TFTLIB *tft)
+    {
+        for (uint8_t n = 0; n < _count; n++)
+        {
+            item &i = _items[n];
+            if (i.layout != NULL)
+            {
+                i.layout->measure(tft);
+                i.mw = i.layout->_mw;
+                i.mh = i.layout->_mh;
+            }
+            else
+            {
+                Control *c = i.control;
+                Rect b = c->getBounds(tft);
+                if (b.isEmpty())
+                    b = {(int16_t)c->x, (int16_t)c->y, (int16_t)c->w, (int16_t)c->h};
+                i.ox = b.x - c->x;
+                i.oy = b.y - c->y;
+                i.ow = b.w - c->w;
+                i.oh = b.h - c->h;
+                i.mw = i.w > 0 ? i.w + i.ow : b.w;
+                i.mh = i.h > 0 ? i.h + i.oh : b.h;
+                continue;
+            }
+            if (i.w > 0)
+                i.mw = i.w;
+            if (i.h > 0)
+                i.mh = i.h;
+        }
+
+        int16_t w = 0, h = 0;
+        switch (_kind)
+        {
+        case LAYOUTVSTACK:
+            for (uint8_t n = 0; n < _count; n++)
+            {
+                w = max(w, _items[n].mw);
+                h += _items[n].mh + (n > 0 ? spacing : 0);
+            }
+            break;
+        case LAYOUTHSTACK:
+            for (uint8_t n = 0; n < _count; n++)
+            {
+                w += _items[n].mw + (n > 0 ? spacing : 0);
+                h = max(h, _items[n].mh);
+            }
+            break;
+        case LAYOUTGRID:
+        {
+            int16_t cellW = 0;
+            for (uint8_t n = 0; n < _count; n++)
+                cellW = max(cellW, _items[n].mw);
+            uint8_t columns = gridColumns();
+            for (uint8_t row = 0; row * columns < _count; row++)
+                h += rowHeight(row) + (row > 0 ? spacing : 0);
+            w = columns * cellW + (columns - 1) * spacing;
+            break;
+        }
+        default:
+            for (uint8_t n = 0; n < _count; n++)
+            {
+                w = max(w, _items[n].mw);
+                h = max(h, _items[n].mh);
+            }
+        }
+        _mw = w + 2 * padding;
+        _mh = h + 2 * padding;
+    }
+
+    // columns 0 is taken as 1
+    uint8_t gridColumns()
+    {
+        return columns > 0 ? columns : 1;
+    }
+
+    int16_t rowHeight(uint8_t row)
+    {
+        uint8_t columns = gridColumns();
+        int16_t h = 0;
+        for (uint8_t n = row * columns; n < _count && n < (row + 1) * columns; n++)
+            h = max(h, _items[n].mh);
+        return h;
+    }
+
+    // arrange pass: the items into area
+    void place(const Rect &area)
+    {
+        Rect r = {(int16_t)(area.x + padding), (int16_t)(area.y + padding), (int16_t)(area.w - 2 * padding), (int16_t)(area.h - 2 * padding)};
+
+        switch (_kind)
+        {
+        case LAYOUTVSTACK:
+        case LAYOUTHSTACK:
+        {
+            bool vertical = _kind == LAYOUTVSTACK;
+            uint8_t fill = vertical ? LAYOUTFILLH : LAYOUTFILLW;
+
+            // the space left is shared by the filling items
+            int16_t used = 0;
+            uint8_t fillers = 0;
+            for (uint8_t n = 0; n < _count; n++)
+            {
+                used += (vertical ? _items[n].mh : _items[n].mw) + (n > 0 ? spacing : 0);
+                if (_items[n].flags & fill)
+                    fillers++;
+            }
+            int16_t left = max((vertical ? r.h : r.w) - used, 0);
+
+            int16_t pos = vertical ? r.y : r.x;
+            for (uint8_t n = 0; n < _count; n++)
+            {
+                item &i = _items[n];
+                int16_t size = vertical ? i.mh : i.mw;
+                if ((i.flags & fill) && fillers > 0)
+                {
+                    int16_t share = left / fillers;
+                    size += share;
+                    left -= share;
+                    fillers--;
+                }
+
+                if (vertical)
+                    placeItem(i, {r.x, pos, r.w, size});
+                else
+                    placeItem(i, {pos, r.y, size, r.h});
+                pos += size + spacing;
+            }
+            break;
+        }
+        case LAYOUTGRID:
+        {
+            uint8_t columns = gridColumns();
+            int16_t cellW = (r.w - (columns - 1) * spacing) / columns;
+            int16_t rowY = r.y;
+            for (uint8_t row = 0; row * columns < _count; row++)
+            {
+                int16_t cellH = rowHeight(row);
+                for (uint8_t n = row * columns; n < _count && n < (row + 1) * columns; n++)
+                    placeItem(_items[n], {(int16_t)(r.x + (n - row * columns) * (cellW + spacing)), rowY, cellW, cellH});
+                rowY += cellH + spacing;
+            }
+            break;
+        }
+        default:
+            for (uint8_t n = 0; n < _count; n++)
+            {
+                item &i = _items[n];
+                Rect cell = {0, 0, i.mw, i.mh};
+                anchor(i.flags & LAYOUTLEFT, i.flags & LAYOUTRIGHT, r.x, r.w, cell.x, cell.w);
+                anchor(i.flags & LAYOUTTOP, i.flags & LAYOUTBOTTOM, r.y, r.h, cell.y, cell.h);
+                placeItem(i, cell);
+            }
+        }
+    }
+
+    static void anchor(bool start, bool end, int16_t from, int16_t length, int16_t &pos, int16_t &size)
+    {
+        if (start && end)
+        {
+            pos = from;
+            size = length;
+        }
+        else if (end)
+            pos = from + length - size;
+        else if (start)
+            pos = from;
+        else
+            pos = from + (length - size) / 2;
+    }
+
+    // item at the top left of cell, filled or with its measured size
+    void placeItem(item &i, const Rect &cell)
+    {
+        int16_t w = (i.flags & LAYOUTFILLW) || _kind == LAYOUTANCHOR ? cell.w : min(i.mw, cell.w);
+        int16_t h = (i.flags & LAYOUTFILLH) || _kind == LAYOUTANCHOR ? cell.h : min(i.mh, cell.h);
+
+        if (i.layout != NULL)
+        {
+            i.layout->place({cell.x, cell.y, w, h});
+            return;
+        }
+
+        Control *c = i.control;
+        uint16_t oldW = c->w, oldH = c->h;
+        if (i.w > 0 || (i.flags & LAYOUTFILLW) || w != i.mw)
+            c->w = w - i.ow;
+        if (i.h > 0 || (i.flags & LAYOUTFILLH) || h != i.mh)
+            c->h = h - i.oh;
+        c->x = cell.x - i.ox;
+        c->y = cell.y - i.oy;
+        c->_dirty = true;
+        if (c->w != oldW || c->h != oldH)
+            c->resized();
+    }
+};
@@ -0,0 +1,157 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Number to text without float math and without heap (replacement for ltoa, ultoa and dtostrf).
+ * Fixed point values are integers with scale decimal digits, e.g. 12345 with scale 2 is 123.45.
+ * All functions return the length of the text written to out.
+ */
+
+// more decimals do not fit into uint32_t fixed point values
+#define MAXDECIMALS 9
+
+class NumberFormat
+{
+public:
+    // up to 10 digits and the sign, out must hold 12 chars
+    static uint8_t formatUnsigned(uint32_t value, char *out)
+    {
+        char digits[10];
+        uint8_t n = 0;
+
+        do
+        {
+            uint32_t q = value / 10;
+            digits[n++] = '0' + (value - q * 10);
+            value = q;
+        } while (value > 0);
+
+        for (uint8_t i = 0; i < n; i++)
+            out[i] = digits[n - 1 - i];
+        out[n] = '\0';
+        return n;
+    }
+
+    static uint8_t formatInt(int32_t value, char *out)
+    {
+        if (value < 0)
+        {
+            out[0] = '-';
+            return formatUnsigned(-(uint32_t)value, out + 1) + 1;
+        }
+        return formatUnsigned(value, out);
+    }
+
+    // value with scale decimal digits, printed with decimals digits (rounded half away from zero)
+    // at most MAXDECIMALS decimals and size - 1 chars are written, 22 chars hold every value
+    static uint8_t formatFixed(int32_t value, uint8_t scale, uint8_t decimals, char *out, uint8_t size = 22)
+    {
+        if (value < 0)
+            return formatFixed(-(uint32_t)value, true, scale, decimals, out, size);
+        return formatFixed((uint32_t)value, false, scale, decimals, out, size);
+    }
+
+    static uint8_t formatFixed(uint32_t magnitude, bool negative, uint8_t scale, uint8_t decimals, char *out, uint8_t size = 22)
+    {
+        if (size == 0)
+            return 0;
+        if (scale > MAXDECIMALS)
+            scale = MAXDECIMALS;
+        if (decimals > MAXDECIMALS)
+            decimals = MAXDECIMALS;
+
+        // drop the digits that are not shown
+        if (scale > decimals)
+        {
+            uint32_t drop = pow10(scale - decimals);
+            uint32_t rest = magnitude % drop;
+            magnitude /= drop;
+            if (rest >= drop / 2)
+                magnitude++;
+            scale = decimals;
+        }
+
+        uint32_t divisor = pow10(scale);
+        uint32_t whole = magnitude / divisor;
+        uint32_t fraction = magnitude - whole * divisor;
+        char buf[22];
+        uint8_t n = 0;
+
+        if (negative && magnitude != 0)
+            buf[n++] = '-';
+        n += formatUnsigned(whole, buf + n);
+
+        if (decimals > 0)
+        {
+            buf[n++] = '.';
+            // digits that are there, zeros for the ones that are not
+            for (int8_t i = scale - 1; i >= 0; i--)
+            {
+                uint32_t p = pow10(i);
+                uint32_t digit = fraction / p;
+                buf[n++] = '0' + digit;
+                fraction -= digit * p;
+            }
+            for (uint8_t i = scale; i < decimals; i++)
+                buf[n++] = '0';
+        }
+
+        if (n > size - 1)
+            n = size - 1;
+        memcpy(out, buf, n);
+        out[n] = '\0';
+        return n;
+    }
+
+    // rounds value to decimals once and prints it as fixed point, at most size - 1 chars are written
+    // values out of the int32_t range (and nan, inf) are printed by snprintf
+    static uint8_t formatFloat(float value, uint8_t decimals, char *out, uint8_t size)
+    {
+        if (size == 0)
+            return 0;
+        if (decimals > MAXDECIMALS)
+            decimals = MAXDECIMALS;
+
+        int32_t fixed;
+        if (!toFixed(value, decimals, fixed))
+        {
+            int n = snprintf(out, size, "%.*f", decimals, (double)value);
+            if (n < 0)
+                n = 0;
+            out[n < size ? n : size - 1] = '\0';
+            return n < size ? n : size - 1;
+        }
+        return formatFixed(fixed, decimals, decimals, out, size);
+    }
+
+    // value * 10^decimals rounded, false if it does not fit
+    static bool toFixed(float value, uint8_t decimals, int32_t &fixed)
+    {
+        if (decimals > MAXDECIMALS)
+            return false;
+        float scaled = value * (float)pow10(decimals);
+        if (!(scaled < 2147483520.0f && scaled > -2147483520.0f))
+            return false;
+        fixed = scaled < 0 ? (int32_t)(scaled - 0.5f) : (int32_t)(scaled + 0.5f);
+        return true;
+    }
+
+    // right aligns text of length n to minWidth with spaces (like dtostrf), text must hold minWidth + 1 chars
+    static uint8_t padLeft(char *text, uint8_t n, uint8_t minWidth)
+    {
+        if (n >= minWidth)
+            return n;
+
+        uint8_t pad = minWidth - n;
+        memmove(text + pad, text, n + 1);
+        memset(text, ' ', pad);
+        return minWidth;
+    }
+
+    static uint32_t pow10(uint8_t exponent)
+    {
+        static const uint32_t powers[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+        return powers[exponent < 9 ? exponent : 9];
+    }
+};
@@ -0,0 +1,59 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * A value that controls can bind to (Control::bind). Every write that changes the value counts up its version;
+ * BUI::update() compares the versions once per frame, so any number of writes between two frames reach the
+ * bound controls as one change, and only controls whose value really changed are marked for redraw.
+ *
+ *   Observable level;
+ *   sl1.bind(&level); // the slider writes level when it is moved
+ *   bg1.bind(&level); // bar graph and donut follow it
+ *   dg1.bind(&level);
+ *   level = 42;       // from anywhere in the sketch
+ */
+
+class Observable
+{
+public:
+    Observable(float initial = 0)
+    {
+        _value = initial;
+    };
+
+    void set(float value)
+    {
+        if (value != _value)
+        {
+            _value = value;
+            _version++;
+        }
+    }
+
+    float get() const
+    {
+        return _value;
+    }
+
+    // counts up with every change
+    uint32_t version() const
+    {
+        return _version;
+    }
+
+    Observable &operator=(float value)
+    {
+        set(value);
+        return *this;
+    }
+
+    operator float() const
+    {
+        return _value;
+    }
+
+private:
+    float _value;
+    uint32_t _version = 1;
+};
@@ -0,0 +1,236 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Framebuffer of 8 bit palette indices for NOFRAMEBUFFER builds (half the RAM of a RGB565 framebuffer).
+ * BUI renders bands into its band buffer (setBandBuffer), stores them as indices here and sends the changed
+ * lines once per frame, expanded to RGB565 through the 256 entry palette.
+ *
+ *   uint8_t frame[480 * 320];
+ *   uint16_t band[480 * 16];
+ *   PaletteFrame paletteFrame(frame, 480, 320);
+ *   ui.setBandBuffer(band, 16);
+ *   ui.setPaletteFrame(&paletteFrame);
+ *
+ * Colors get a palette index when they are drawn the first time. Preset the colors of the UI with setPalette()
+ * if the order matters. When all 256 indices are used, new colors are shown as the nearest palette color.
+ *
+ * After setRotation() BUI lays the frame out for the new size (setSize), as long as width x height fits into the
+ * frame; otherwise it draws the bands directly to the display.
+ */
+
+// reverse lookup color -> index, power of 2 and larger than 256
+#define PALETTEHASHSIZE 1024
+
+class PaletteFrame
+{
+public:
+    PaletteFrame(uint8_t *frame, uint16_t width, uint16_t height)
+    {
+        _frame = frame;
+        _size = (uint32_t)width * height;
+        _width = width;
+        _height = height;
+        memset(_frame, 0, _size);
+        clearPalette();
+    }
+
+    // lays the frame out for width x height, false if it does not fit into the frame of the constructor
+    bool setSize(uint16_t width, uint16_t height)
+    {
+        if ((uint32_t)width * height > _size)
+            return false;
+
+        _width = width;
+        _height = height;
+        _sendY1 = 0;
+        _sendY2 = 0;
+        return true;
+    }
+
+    uint16_t getWidth()
+    {
+        return _width;
+    }
+
+    uint16_t getHeight()
+    {
+        return _height;
+    }
+
+    // before the first update, the stored indices refer to the palette
+    void setPalette(const uint16_t *colors, uint16_t count)
+    {
+        clearPalette();
+        for (uint16_t i = 0; i < count && i < 256; i++)
+            index(colors[i]);
+    }
+
+    void clearPalette()
+    {
+        _count = 0;
+        _lookups = 0;
+        for (uint16_t i = 0; i < PALETTEHASHSIZE; i++)
+            _hash[i].used = false;
+    }
+
+    uint16_t getColorsCount()
+    {
+        return _count;
+    }
+
+    // palette index of color, new colors are added
+    uint8_t index(uint16_t color)
+    {
+        uint16_t slot = (color * 40503U) & (PALETTEHASHSIZE - 1);
+        while (_hash[slot].used)
+        {
+            if (_hash[slot].color == color)
+                return _hash[slot].index;
+            slot = (slot + 1) & (PALETTEHASHSIZE - 1);
+        }
+
+        uint8_t i = _count < 256 ? _count : nearest(color);
+        if (_count < 256)
+            _palette[_count++] = color;
+
+        // remember mapped colors as well, while the table has room
+        if (_lookups < PALETTEHASHSIZE * 3 / 4)
+        {
+            _hash[slot].used = true;
+            _hash[slot].color = color;
+            _hash[slot].index = i;
+            _lookups++;
+        }
+        return i;
+    }
+
+    // stores w x h pixels (lines one after another) at x, y, clipped to the frame
+    void store(const uint16_t *pixels, int16_t x, int16_t y, uint16_t w, uint16_t h)
+    {
+        int16_t x1 = max(x, (int16_t)0), y1 = max(y, (int16_t)0);
+        int16_t x2 = min((int32_t)x + w, (int32_t)_width), y2 = min((int32_t)y + h, (int32_t)_height);
+        if (x1 >= x2 || y1 >= y2)
+            return;
+
+        uint16_t stride = w;
+        pixels += (y1 - y) * stride + (x1 - x);
+        x = x1;
+        y = y1;
+        w = x2 - x1;
+        h = y2 - y1;
+
+        uint16_t lastColor = pixels[0];
+        uint8_t lastIndex = index(lastColor);
+
+        for (uint16_t line = 0; line < h; line++)
+        {
+            uint8_t *dst = _frame + (uint32_t)(y + line) * _width + x;
+            const uint16_t *src = pixels + (uint32_t)line * stride;
+            for (uint16_t i = 0; i < w; i++)
+            {
+                // runs of one color are common in UIs
+                uint16_t color = *src++;
+                if (color != lastColor)
+                {
+                    lastColor = color;
+                    lastIndex = index(color);
+                }
+                dst[i] = lastIndex;
+            }
+        }
+
+        if (y < _sendY1 || _sendY1 >= _sendY2)
+            _sendY1 = y;
+        if (y + h > _sendY2)
+            _sendY2 = y + h;
+    }
+
+    // sends the changed lines, expanded through line buffer of lineBufferSize pixels (at least one line)
+    void send(TFTLIB *tft, uint16_t *lineBuffer, uint32_t lineBufferSize)
+    {
+        uint16_t lines = lineBufferSize / _width;
+
+        for (uint16_t y = _sendY1; y < _sendY2; y += lines)
+        {
+            uint16_t h = min(lines, (uint16_t)(_sendY2 - y));
+            expand(_frame + (uint32_t)y * _width, lineBuffer, (uint32_t)h * _width);
+            tft->writeRect(0, y, _width, h, lineBuffer);
+        }
+
+        _sendY1 = 0;
+        _sendY2 = 0;
+    }
+
+    uint8_t *getFrame()
+    {
+        return _frame;
+    }
+
+private:
+    struct lookup
+    {
+        uint16_t color;
+        uint8_t index;
+        bool used;
+    };
+
+    uint8_t *_frame;
+    uint32_t _size; // bytes of _frame
+    uint16_t _width;
+    uint16_t _height;
+    uint16_t _palette[256];
+    uint16_t _count = 0;
+    lookup _hash[PALETTEHASHSIZE];
+    uint16_t _lookups = 0;
+    uint16_t _sendY1 = 0; // lines to send
+    uint16_t _sendY2 = 0;
+
+    void expand(const uint8_t *src, uint16_t *dst, uint32_t n)
+    {
+        const uint16_t *lut = _palette;
+
+        // 8 pixels per step, 4 bytes read at once
+        while (n >= 8)
+        {
+            uint32_t a, b;
+            memcpy(&a, src, 4);
+            memcpy(&b, src + 4, 4);
+            dst[0] = lut[a & 0xFF];
+            dst[1] = lut[(a >> 8) & 0xFF];
+            dst[2] = lut[(a >> 16) & 0xFF];
+            dst[3] = lut[a >> 24];
+            dst[4] = lut[b & 0xFF];
+            dst[5] = lut[(b >> 8) & 0xFF];
+            dst[6] = lut[(b >> 16) & 0xFF];
+            dst[7] = lut[b >> 24];
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--)
+            *dst++ = lut[*src++];
+    }
+
+    uint8_t nearest(uint16_t color)
+    {
+        int16_t r = color >> 11, g = (color >> 5) & 0x3F, b = color & 0x1F;
+        uint32_t best = 0xFFFFFFFF;
+        uint8_t bestIndex = 0;
+
+        for (uint16_t i = 0; i < _count; i++)
+        {
+            int16_t dr = r - (_palette[i] >> 11);
+            int16_t dg = g - ((_palette[i] >> 5) & 0x3F);
+            int16_t db = b - (_palette[i] & 0x1F);
+            uint32_t d = 4 * dr * dr + dg * dg + 4 * db * db;
+            if (d < best)
+            {
+                best = d;
+                bestIndex = i;
+            }
+        }
+        return bestIndex;
+    }
+};
@@ -0,0 +1,148 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Tasks of the pipelined BUI (PIPELINE) and of the TileRenderer: a std::thread on Linux (host builds), a FreeRTOS
+ * task pinned to a core on the ESP32 (ILI9486_esp32), where loop() runs on core 1 and the render task on core 0.
+ * A Teensy has one core, there is nothing to run in parallel.
+ */
+
+#if defined(ARDUINO_ARCH_ESP32) || defined(ESP_PLATFORM)
+#define TASKSESP32
+#elif defined(__linux__)
+#define TASKSTHREADS
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#else
+#error "PIPELINE needs two cores: std::thread (Linux) or FreeRTOS tasks (ESP32)"
+#endif
+
+// core of the render task on the ESP32
+#ifndef RENDERCORE
+#define RENDERCORE 0
+#endif
+#define TASKSTACK 4096
+
+class Task
+{
+public:
+    // runs function(arg) in its own task, false if it could not be created
+    bool start(void (*function)(void *), void *arg, uint8_t core = RENDERCORE)
+    {
+        _function = function;
+        _arg = arg;
+#ifdef TASKSTHREADS
+        _thread = std::thread(run, this);
+        return true;
+#else
+        _done = xSemaphoreCreateBinary();
+        if (_done == NULL)
+            return false;
+        return xTaskCreatePinnedToCore(run, "BUI", TASKSTACK, this, 1, NULL, core) == pdPASS;
+#endif
+    }
+
+    // waits until the function returned
+    void join()
+    {
+#ifdef TASKSTHREADS
+        if (_thread.joinable())
+            _thread.join();
+#else
+        if (_done != NULL)
+        {
+            xSemaphoreTake(_done, portMAX_DELAY);
+            vSemaphoreDelete(_done);
+            _done = NULL;
+        }
+#endif
+    }
+
+    // lets the other tasks run while waiting (on the ESP32 for a tick, so the idle task of the core runs too)
+    static void pause()
+    {
+#ifdef TASKSTHREADS
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+#else
+        vTaskDelay(1);
+#endif
+    }
+
+private:
+    void (*_function)(void *) = NULL;
+    void *_arg = NULL;
+#ifdef TASKSTHREADS
+    std::thread _thread;
+#else
+    SemaphoreHandle_t _done = NULL;
+#endif
+
+    static void run(void *task)
+    {
+        Task *t = (Task *)task;
+        t->_function(t->_arg);
+#ifdef TASKSESP32
+        // a FreeRTOS task must not return
+        xSemaphoreGive(t->_done);
+        vTaskDelete(NULL);
+#endif
+    }
+};
+
+// counting semaphore: take() waits until give() was called once more than take() returned
+class Signal
+{
+public:
+    Signal()
+    {
+#ifdef TASKSESP32
+        _semaphore = xSemaphoreCreateCounting(255, 0);
+#endif
+    }
+
+    ~Signal()
+    {
+#ifdef TASKSESP32
+        if (_semaphore != NULL)
+            vSemaphoreDelete(_semaphore);
+#endif
+    }
+
+    Signal(const Signal &) = delete;
+    Signal &operator=(const Signal &) = delete;
+
+    void give()
+    {
+#ifdef TASKSTHREADS
+        std::lock_guard<std::mutex> lock(_mutex);
+        _count++;
+        _changed.notify_one();
+#else
+        xSemaphoreGive(_semaphore);
+#endif
+    }
+
+    void take()
+    {
+#ifdef TASKSTHREADS
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (_count == 0)
+            _changed.wait(lock);
+        _count--;
+#else
+        xSemaphoreTake(_semaphore, portMAX_DELAY);
+#endif
+    }
+
+private:
+#ifdef TASKSTHREADS
+    std::mutex _mutex;
+    std::condition_variable _changed;
+    uint32_t _count = 0;
+#else
+    SemaphoreHandle_t _semaphore = NULL;
+#endif
+};
@@ -0,0 +1,386 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Screens described by data instead of code: tools/screen2bui.py compiles a JSON description into a screen
+ * (C header in flash or .bus file). Screen::load() creates the controls in an arena given by the sketch and adds
+ * them to BUI, without heap and without parsing. Texts and images are used where they are (zero copy), so the
+ * data has to stay in place while the screen is shown (flash, a mapped file or a buffer the file was read into).
+ *
+ *   #include "settings_screen.h"             // from: python3 tools/screen2bui.py settings.json
+ *   uint8_t arena[4096];
+ *   Screen screen(arena, sizeof(arena));
+ *   screen.setFonts(settings_fonts, 2);      // the tables the indices of the screen refer to
+ *   screen.setValues(settings_values, 1);
+ *   screen.setHandlers(settings_handlers, 1);
+ *   screen.load(&ui, settings);
+ *
+ * layout (little endian, 4 byte aligned):
+ *   header   'B' 'U' 'S' '1', control count (2), record size (2), background color (2), flags (2), size (4)
+ *   records  control count * ScreenRecord, in the order they are drawn
+ *   data     texts (0 terminated) and images (.bui image files, see ImageData.h), referred to by offset
+ */
+
+#include <new>
+
+// record size of version 1
+#define SCREENRECORDSIZE 36
+
+// header flags
+#define SCREENBACKCOLOR 0x01 // the screen sets the background color
+
+// record flags
+#define SCREENDISABLED 0x01
+#define SCREENOPAQUE 0x02
+#define SCREENCHECKED 0x04
+#define SCREENCOLORS 0x08 // foreColor and backColor are set
+
+// no font, value or handler
+#define SCREENNONE 0xFF
+
+struct ScreenHeader
+{
+    char magic[4];
+    uint16_t count;
+    uint16_t recordSize;
+    uint16_t backColor;
+    uint16_t flags;
+    uint32_t size;
+};
+
+struct ScreenRecord
+{
+    uint8_t type;    // BUTTON, LABEL, ...
+    uint8_t font;    // index into the fonts, SCREENNONE = default font
+    uint8_t binding; // index into the values
+    uint8_t handler; // index into the handlers
+    int16_t x;
+    int16_t y;
+    uint16_t w;
+    uint16_t h;
+    uint16_t foreColor; // BarGraph, DonutGraph: bar color
+    uint16_t backColor; // Box: color
+    float min;      // DropDown: selected index, -1 = none
+    float max;
+    uint32_t text;  // offset of the text (DropDown: options one after another, ended by an empty one), 0 = none
+    uint32_t image; // offset of the image, 0 = none
+    uint8_t flags;
+    uint8_t align;
+    uint16_t reserved;
+};
+
+static_assert(sizeof(ScreenHeader) == 16, "ScreenHeader is stored as is");
+static_assert(sizeof(ScreenRecord) == SCREENRECORDSIZE, "ScreenRecord is stored as is");
+
+class Screen
+{
+public:
+    Screen(uint8_t *arena, uint32_t size)
+    {
+        _arena = arena;
+        _size = size;
+    }
+
+    void setFonts(const FONTS *const *fonts, uint8_t count)
+    {
+        _fonts = fonts;
+        _fontsCount = count;
+    }
+
+    void setValues(Observable *const *values, uint8_t count)
+    {
+        _values = values;
+        _valuesCount = count;
+    }
+
+    void setHandlers(void (*const *handlers)(), uint8_t count)
+    {
+        _handlers = handlers;
+        _handlersCount = count;
+    }
+
+    // starts a new screen on ui with the controls of data, the controls of the last load() are overwritten
+    // false if data is no screen of this version, or the arena or BUI is full (the controls up to there are shown)
+    bool load(BUI *ui, const uint8_t *data)
+    {
+        _used = 0;
+        _count = 0;
+        ui->initNewScreen();
+
+        // used in place, so it has to be aligned
+        const ScreenHeader *header = (const ScreenHeader *)data;
+        if (((uintptr_t)data & 3) != 0 || memcmp(header->magic, "BUS1", 4) != 0 || header->recordSize != SCREENRECORDSIZE)
+            return false;
+        if (sizeof(ScreenHeader) + (uint32_t)header->count * SCREENRECORDSIZE > header->size)
+            return false;
+
+        _data = data;
+        _dataSize = header->size;
+        if (header->flags & SCREENBACKCOLOR)
+            ui->setBackColor(header->backColor);
+
+        const ScreenRecord *records = (const ScreenRecord *)(data + sizeof(ScreenHeader));
+        for (uint16_t i = 0; i < header->count && i < MAXCONTROLS; i++)
+        {
+            Control *control = create(records[i]);
+            if (control == NULL || !ui->addControl(control))
+                return false;
+
+            // after addControl(), it sets the colors of the theme
+            // the color of the constructor of graphs (foreColor) and Box (backColor) is no control color
+            const ScreenRecord &r = records[i];
+            if (r.flags & SCREENCOLORS && r.type != BOX)
+            {
+                if (r.type != BARGRAPH && r.type != DONUTGRAPH)
+                    control->foreColor = r.foreColor;
+                control->backColor = r.backColor;
+            }
+            _controls[_count++] = control;
+        }
+        return header->count <= MAXCONTROLS;
+    }
+
+    uint8_t getControlsCount()
+    {
+        return _count;
+    }
+
+    // in the order of the description (the generated header has a #define for every named control)
+    Control *getControl(uint8_t index)
+    {
+        return index < _count ? _controls[index] : NULL;
+    }
+
+    // bytes of the arena used by the controls
+    uint32_t getArenaUsed()
+    {
+        return _used;
+    }
+
+private:
+    uint8_t *_arena;
+    uint32_t _size;
+    uint32_t _used = 0;
+    const uint8_t *_data = NULL;
+    uint32_t _dataSize = 0;
+    Control *_controls[MAXCONTROLS];
+    uint8_t _count = 0;
+
+    const FONTS *const *_fonts = NULL;
+    uint8_t _fontsCount = 0;
+    Observable *const *_values = NULL;
+    uint8_t _valuesCount = 0;
+    void (*const *_handlers)() = NULL;
+    uint8_t _handlersCount = 0;
+
+    void *take(uint32_t size)
+    {
+        uint32_t start = (_used + 7) & ~7UL;
+        if (start + size > _size)
+            return NULL;
+        _used = start + size;
+        return _arena + start;
+    }
+
+    // texts that are not terminated inside the data are empty
+    char *text(uint32_t offset)
+    {
+        if (offset == 0 || offset >= _dataSize)
+            return (char *)"";
+        const char *t = (const char *)(_data + offset);
+        if (strnlen(t, _dataSize - offset) == _dataSize - offset)
+            return (char *)"";
+        return (char *)t;
+    }
+
+    // image of the screen data, only the ImageData is in the arena
+    // NULL if the header is not one FileImage accepts or the pixels do not fit into the data
+    const ImageData *image(uint32_t offset)
+    {
+        const uint8_t *file = _data + offset;
+        if (offset == 0 || offset + 12 > _dataSize || memcmp(file, "BUI1", 4) != 0)
+            return NULL;
+
+        uint16_t width = file[4] | (file[5] << 8);
+        uint16_t height = file[6] | (file[7] << 8);
+        uint8_t format = file[8];
+        uint8_t bpp = file[9];
+        uint16_t paletteCount = file[10] | (file[11] << 8);
+        if (paletteCount > 256 || !FileImage::valid(format, bpp, paletteCount))
+            return NULL;
+
+        uint32_t dataOffset = 12 + paletteCount * 2;
+        if (dataOffset > _dataSize - offset)
+            return NULL;
+        const uint8_t *data = file + dataOffset;
+        uint32_t size = _dataSize - offset - dataOffset;
+
+        bool fits;
+        if (format == IMG_RAW)
+            fits = (uint32_t)width * height * 2 <= size;
+        else if (format == IMG_INDEXED)
+            fits = (uint32_t)height * (((uint32_t)width * bpp + 7) / 8) <= size;
+        else
+            fits = validRLE(data, size, (uint32_t)width * height, paletteCount);
+        if (!fits)
+            return NULL;
+
+        ImageData *image = (ImageData *)take(sizeof(ImageData));
+        if (image == NULL)
+            return NULL;
+
+        image->width = width;
+        image->height = height;
+        image->format = format;
+        image->bpp = bpp;
+        image->palette = paletteCount > 0 ? (const uint16_t *)(file + 12) : NULL;
+        image->data = data;
+        image->source = NULL;
+        image->dataOffset = 0;
+        return image;
+    }
+
+    // the packets of pixels pixels end inside size bytes, indices are in the palette
+    bool validRLE(const uint8_t *data, uint32_t size, uint32_t pixels, uint16_t paletteCount)
+    {
+        uint8_t valueSize = paletteCount > 0 ? 1 : 2;
+        uint32_t i = 0;
+
+        while (pixels > 0)
+        {
+            if (i >= size)
+                return false;
+            uint8_t control = data[i++];
+            uint32_t count = (control & 0x7F) + 1;
+            uint32_t values = control & 0x80 ? 1 : count;
+            if (values * valueSize > size - i)
+                return false;
+            if (paletteCount > 0)
+            {
+                for (uint32_t v = 0; v < values; v++)
+                {
+                    if (data[i + v] >= paletteCount)
+                        return false;
+                }
+            }
+            i += values * valueSize;
+            pixels -= count < pixels ? count : pixels;
+        }
+        return true;
+    }
+
+    Control *create(const ScreenRecord &r)
+    {
+        void (*handler)() = r.handler < _handlersCount ? _handlers[r.handler] : nullptr;
+        char *t = text(r.text);
+        void *p;
+        Control *c = NULL;
+
+        switch (r.type)
+        {
+        case BUTTON:
+            if ((p = take(sizeof(Button))) != NULL)
+            {
+                Button *button = new (p) Button(r.x, r.y, r.w, r.h, t, handler);
+                if (r.image != 0)
+                {
+                    const ImageData *i = image(r.image);
+                    if (i != NULL)
+                        button->setImage(i);
+                }
+                c = button;
+            }
+            break;
+        case LABEL:
+            if ((p = take(sizeof(Label))) != NULL)
+            {
+                Label *label = new (p) Label(r.x, r.y, t);
+                label->textAlign = r.align;
+                label->maxWidth = r.w;
+                c = label;
+            }
+            break;
+        case CHECKBOX:
+            if ((p = take(sizeof(CheckBox))) != NULL)
+            {
+                CheckBox *checkBox = new (p) CheckBox(r.x, r.y, t, handler);
+                checkBox->checked = r.flags & SCREENCHECKED;
+                c = checkBox;
+            }
+            break;
+        case SLIDER:
+            if ((p = take(sizeof(Slider))) != NULL)
+                c = new (p) Slider(r.x, r.y, r.w, r.h, r.min, r.max, handler);
+            break;
+        case NUMUD:
+            if ((p = take(sizeof(NumericUpDown))) != NULL)
+                c = new (p) NumericUpDown(r.x, r.y, r.w, r.h, r.min, r.max, handler);
+            break;
+        case BARGRAPH:
+            if ((p = take(sizeof(BarGraph))) != NULL)
+                c = new (p) BarGraph(r.x, r.y, r.w, r.h, r.min, r.max, r.foreColor, t, handler);
+            break;
+        case DONUTGRAPH:
+            if ((p = take(sizeof(DonutGraph))) != NULL)
+                c = new (p) DonutGraph(r.x, r.y, r.min, r.max, r.foreColor, t, handler);
+            break;
+        case IMAGE:
+        {
+            const ImageData *i = image(r.image);
+            if (i != NULL && (p = take(sizeof(Image))) != NULL)
+            {
+                Image *img = new (p) Image(r.x, r.y, i);
+                img->imageHAlign = r.align;
+                c = img;
+            }
+            break;
+        }
+        case BOX:
+            if ((p = take(sizeof(Box))) != NULL)
+                c = new (p) Box(r.x, r.y, r.w, r.h, r.backColor);
+            break;
+        case DROPDOWN:
+            if ((p = take(sizeof(DropDown))) != NULL)
+            {
+                DropDown *dropDown = new (p) DropDown(r.x, r.y, r.w, r.h, handler);
+                for (uint32_t offset = r.text; offset != 0 && offset < _dataSize && _data[offset] != '\0';)
+                {
+                    // an option not terminated before the end of the data is left out
+                    char *option = text(offset);
+                    uint32_t length = strnlen(option, _dataSize - offset);
+                    if (length == _dataSize - offset)
+                        break;
+                    dropDown->addOption(option);
+                    offset += length + 1;
+                }
+                if (r.min >= 0)
+                    dropDown->setSelectedIndex(r.min);
+                c = dropDown;
+            }
+            break;
+        case TEXTBOX:
+            if ((p = take(sizeof(TextBox))) != NULL)
+            {
+                // copied into the text storage, it is edited
+                TextBox *textBox = new (p) TextBox(r.x, r.y, r.w, r.h, handler);
+                if (t[0] != '\0')
+                    textBox->addText(t);
+                c = textBox;
+            }
+            break;
+        }
+
+        if (c == NULL)
+            return NULL;
+
+        if (r.font < _fontsCount)
+            c->setFont(*_fonts[r.font]);
+        if (r.binding < _valuesCount)
+            c->bind(_values[r.binding]);
+        c->enabled = !(r.flags & SCREENDISABLED);
+        if (r.flags & SCREENOPAQUE)
+            c->opaque = true;
+        return c;
+    }
+};
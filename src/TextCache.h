@@ -0,0 +1,274 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Cache of pre-rasterized strings for static captions (Label, CheckBox, Button, graph titles).
+ * A string is rasterized once into a 1 bpp mask and then drawn as horizontal runs in any color,
+ * instead of walking the glyph bitmaps of the font every frame.
+ *
+ * The cache is off by default. Define TEXTCACHEBYTES (RAM for masks) before including BUI.h to use it:
+ *   #define TEXTCACHEBYTES 4096
+ * Strings are only cached when they are drawn a second time, so fast changing texts (counters, values)
+ * do not push the static ones out. When the RAM is full, the least recently used string is removed.
+ * Only 1 bpp fonts (ILI9341_t3 font format version 1) are cached, others are printed as before.
+ */
+
+#ifndef TEXTCACHEBYTES
+#define TEXTCACHEBYTES 0
+#endif
+
+// maximum cached strings
+#ifndef TEXTCACHEENTRIES
+#define TEXTCACHEENTRIES 32
+#endif
+
+#if TEXTCACHEBYTES > 0
+class TextCache : private FontBits
+{
+public:
+    // draws text with the top left of its cursor at x, y; returns false if text is not cached (print it)
+    bool draw(TFTLIB *tft, const FONTS *font, const char *text, int16_t x, int16_t y, uint16_t color)
+    {
+        entry *e = get(font, text);
+        if (e == NULL)
+            return false;
+
+        const uint8_t *mask = _pool + e->offset + e->length;
+        uint16_t stride = (e->maskW + 7) / 8;
+        x += e->maskX;
+        y += e->maskY;
+
+        // color expansion: one line per run of set bits
+        for (uint16_t row = 0; row < e->maskH; row++, mask += stride)
+        {
+            int16_t runStart = -1;
+            for (uint16_t col = 0; col <= e->maskW; col++)
+            {
+                bool set = col < e->maskW && (mask[col >> 3] & (0x80 >> (col & 7)));
+                if (set && runStart < 0)
+                    runStart = col;
+                else if (!set && runStart >= 0)
+                {
+                    tft->drawFastHLine(x + runStart, y + row, col - runStart, color);
+                    runStart = -1;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // returns the pixel width of a cached text or -1
+    int16_t width(const FONTS *font, const char *text)
+    {
+        entry *e = find(font, text, key(font, text), strlen(text));
+        return e != NULL ? e->advance : -1;
+    }
+
+    void clear()
+    {
+        _count = 0;
+        _used = 0;
+    }
+
+private:
+    struct entry
+    {
+        uint32_t hash;
+        const void *font; // glyph data of the font, the FONTS structs are copied into every control
+        uint32_t lastUsed;
+        uint16_t offset; // in _pool: text, then mask
+        uint16_t size;
+        uint16_t length;
+        int16_t maskX; // mask position from cursor
+        int16_t maskY;
+        uint16_t maskW;
+        uint16_t maskH;
+        uint16_t advance;
+    };
+
+    uint8_t _pool[TEXTCACHEBYTES];
+    entry _entries[TEXTCACHEENTRIES];
+    uint32_t _seen[TEXTCACHEENTRIES] = {}; // strings drawn once, cached when seen again
+    uint8_t _seenNext = 0;
+    uint8_t _count = 0;
+    uint16_t _used = 0;
+    uint32_t _tick = 0;
+
+    static uint32_t key(const FONTS *font, const char *text)
+    {
+        uint32_t h = 2166136261UL; // FNV-1a
+        while (*text)
+        {
+            h ^= (uint8_t)*text++;
+            h *= 16777619UL;
+        }
+        return h ^ (uint32_t)(uintptr_t)font->data;
+    }
+
+    entry *find(const FONTS *font, const char *text, uint32_t h, uint16_t length)
+    {
+        for (uint8_t i = 0; i < _count; i++)
+        {
+            entry *e = &_entries[i];
+            if (e->hash == h && e->font == font->data && e->length == length && memcmp(_pool + e->offset, text, length) == 0)
+                return e;
+        }
+        return NULL;
+    }
+
+    entry *get(const FONTS *font, const char *text)
+    {
+        uint32_t h = key(font, text);
+        uint16_t length = strlen(text);
+        entry *e = find(font, text, h, length);
+
+        if (e == NULL)
+        {
+            // admit on second use
+            bool seen = false;
+            for (uint8_t i = 0; i < TEXTCACHEENTRIES; i++)
+            {
+                if (_seen[i] == h)
+                {
+                    seen = true;
+                    _seen[i] = 0;
+                    break;
+                }
+            }
+            if (!seen)
+            {
+                _seen[_seenNext] = h;
+                _seenNext = (_seenNext + 1) % TEXTCACHEENTRIES;
+                return NULL;
+            }
+
+            e = rasterize(font, text, h, length);
+            if (e == NULL)
+                return NULL;
+        }
+
+        e->lastUsed = ++_tick;
+        return e;
+    }
+
+    // removes the least recently used entry and closes its gap in _pool
+    void evict()
+    {
+        uint8_t lru = 0;
+        for (uint8_t i = 1; i < _count; i++)
+        {
+            if (_entries[i].lastUsed < _entries[lru].lastUsed)
+                lru = i;
+        }
+
+        uint16_t offset = _entries[lru].offset;
+        uint16_t size = _entries[lru].size;
+        memmove(_pool + offset, _pool + offset + size, _used - offset - size);
+        _used -= size;
+
+        for (uint8_t i = 0; i < _count; i++)
+        {
+            if (_entries[i].offset > offset)
+                _entries[i].offset -= size;
+        }
+        _entries[lru] = _entries[--_count];
+    }
+
+    entry *rasterize(const FONTS *font, const char *text, uint32_t h, uint16_t length)
+    {
+        if (font->version != 1)
+            return NULL;
+
+        uint32_t bitoffset, width, height, delta;
+        int32_t xoffset, yoffset;
+
+        // bounds of all glyphs
+        int16_t x1 = 0x7FFF, y1 = 0x7FFF, x2 = -0x7FFF, y2 = -0x7FFF;
+        int16_t cursorX = 0;
+        for (uint16_t i = 0; i < length; i++)
+        {
+            if (text[i] == '\n')
+                return NULL;
+            if (glyph(font, text[i], bitoffset, width, height, xoffset, yoffset, delta) == NULL)
+                continue;
+            if (width > 0 && height > 0)
+            {
+                int16_t gx = cursorX + xoffset;
+                int16_t gy = font->cap_height - height - yoffset;
+                x1 = min(x1, gx);
+                y1 = min(y1, gy);
+                x2 = max(x2, (int16_t)(gx + width));
+                y2 = max(y2, (int16_t)(gy + height));
+            }
+            cursorX += delta;
+        }
+        if (x2 < x1)
+            x1 = x2 = y1 = y2 = 0;
+
+        uint16_t maskW = x2 - x1;
+        uint16_t maskH = y2 - y1;
+        uint16_t stride = (maskW + 7) / 8;
+        uint32_t size = length + (uint32_t)stride * maskH;
+        if (size > TEXTCACHEBYTES)
+            return NULL;
+
+        while (_count > 0 && (_count == TEXTCACHEENTRIES || _used + size > TEXTCACHEBYTES))
+            evict();
+
+        entry *e = &_entries[_count++];
+        e->hash = h;
+        e->font = font->data;
+        e->offset = _used;
+        e->size = size;
+        e->length = length;
+        e->maskX = x1;
+        e->maskY = y1;
+        e->maskW = maskW;
+        e->maskH = maskH;
+        e->advance = cursorX;
+        _used += size;
+
+        memcpy(_pool + e->offset, text, length);
+        uint8_t *mask = _pool + e->offset + length;
+        memset(mask, 0, size - length);
+
+        // same walk as drawFontChar of the ILI9341_t3 libs
+        cursorX = 0;
+        for (uint16_t i = 0; i < length; i++)
+        {
+            const uint8_t *data = glyph(font, text[i], bitoffset, width, height, xoffset, yoffset, delta);
+            if (data == NULL)
+                continue;
+
+            int16_t gx = cursorX + xoffset - x1;
+            int16_t gy = font->cap_height - height - yoffset - y1;
+            uint32_t row = 0;
+            while (row < height)
+            {
+                uint32_t repeat = 1;
+                if (fetchbit(data, bitoffset++))
+                {
+                    repeat = fetchbits_unsigned(data, bitoffset, 3) + 2;
+                    bitoffset += 3;
+                }
+                for (uint32_t r = 0; r < repeat && row + r < height; r++)
+                {
+                    uint8_t *line = mask + (gy + row + r) * stride;
+                    for (uint32_t col = 0; col < width; col++)
+                    {
+                        if (fetchbit(data, bitoffset + col))
+                            line[(gx + col) >> 3] |= 0x80 >> ((gx + col) & 7);
+                    }
+                }
+                bitoffset += width;
+                row += repeat;
+            }
+            cursorX += delta;
+        }
+
+        return e;
+    }
+};
+#endif
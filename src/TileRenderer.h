@@ -0,0 +1,376 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Draws the FrameRecords of the pipelined BUI (PIPELINE) with more than one core: the screen is cut into tiles, the
+ * ops are binned by the tiles they touch and every thread draws whole tiles into the framebuffer, the ops of a tile in
+ * the order they were recorded. So a pixel is written in the same order as by DisplayList::replay() and the frame is
+ * the same, bit for bit, only the tiles are drawn at the same time.
+ *
+ *   uint16_t bins[8192];                  // op indices per tile, NULL: every tile looks at every op
+ *   TileRenderer tiles(bins, 8192);
+ *   tiles.begin(2);                       // the render task and one more thread
+ *   ui.setTileRenderer(&tiles);           // after setRotation()
+ *
+ * Every thread starts with its own run of tiles; a thread that is done takes the last tile of the run with the most
+ * tiles left, so a busy corner of the screen does not wait for one thread.
+ */
+
+// tiles of RENDERTILE pixels (a power of 2), doubled until there are not more than MAXRENDERTILES
+#ifndef RENDERTILE
+#define RENDERTILE 32
+#endif
+#ifndef MAXRENDERTILES
+#define MAXRENDERTILES 256
+#endif
+// threads, the calling one included
+#ifndef MAXRENDERTHREADS
+#define MAXRENDERTHREADS 8
+#endif
+
+class TileRenderer
+{
+public:
+    TileRenderer(uint16_t *bins = NULL, uint32_t entries = 0)
+    {
+        _bins = bins;
+        _entries = bins != NULL ? entries : 0;
+    }
+
+    ~TileRenderer()
+    {
+        end();
+    }
+
+    TileRenderer(const TileRenderer &) = delete;
+    TileRenderer &operator=(const TileRenderer &) = delete;
+
+    // threads: 1 .. MAXRENDERTHREADS, the thread calling render() is one of them, false if a thread could not be started
+    bool begin(uint8_t threads)
+    {
+        end();
+        if (threads < 1 || threads > MAXRENDERTHREADS)
+            return false;
+
+        _stop = false;
+        for (uint8_t i = 1; i < threads; i++)
+        {
+            _workers[i].renderer = this;
+            _workers[i].index = i;
+#ifdef TASKSESP32
+            uint8_t core = (RENDERCORE + i) % portNUM_PROCESSORS;
+#else
+            uint8_t core = RENDERCORE;
+#endif
+            if (!_workers[i].task.start(work, &_workers[i], core))
+            {
+                end();
+                return false;
+            }
+            _threads = i + 1;
+        }
+        _threads = threads;
+        return true;
+    }
+
+    // stops the threads, render() then draws alone
+    void end()
+    {
+        _stop = true;
+        for (uint8_t i = 1; i < _threads; i++)
+        {
+            _workers[i].wake.give();
+            _workers[i].task.join();
+        }
+        _threads = 1;
+    }
+
+    // draws record into frame (width * height pixels), returns when all tiles are drawn
+    void render(const FrameRecord *record, uint16_t *frame, int16_t width, int16_t height)
+    {
+        if (record->count == 0 || frame == NULL || width <= 0 || height <= 0)
+            return;
+
+        _record = record;
+        _frame = frame;
+        _width = width;
+        _height = height;
+        _shift = 0;
+        while ((1 << _shift) < RENDERTILE)
+            _shift++;
+        while ((((width - 1) >> _shift) + 1) * (((height - 1) >> _shift) + 1) > MAXRENDERTILES)
+            _shift++;
+        _columns = ((width - 1) >> _shift) + 1;
+        _tiles = _columns * (((height - 1) >> _shift) + 1);
+
+        // every thread bins a part of the ops, the parts of a tile one after the other keep the order of the record
+        _binned = _bins != NULL;
+        if (_binned)
+        {
+            run(COUNTOPS);
+            uint32_t used = 0;
+            for (uint16_t t = 0; t < _tiles; t++)
+            {
+                _start[t] = used;
+                for (uint8_t i = 0; i < _threads; i++)
+                {
+                    uint32_t count = _bin[i][t];
+                    _bin[i][t] = used;
+                    used += count;
+                }
+            }
+            _start[_tiles] = used;
+            _binned = used <= _entries;
+            if (_binned)
+                run(BINOPS);
+        }
+
+        for (uint8_t i = 0; i < _threads; i++)
+        {
+            uint16_t first = _tiles * i / _threads;
+            uint16_t last = _tiles * (i + 1) / _threads;
+            __atomic_store_n(&_runs[i], first | ((uint32_t)last << 16), __ATOMIC_RELAXED);
+        }
+        run(DRAWTILES);
+    }
+
+    uint8_t getThreads()
+    {
+        return _threads;
+    }
+
+    // tiles drawn by another thread than the one they were given to
+    uint32_t getSteals()
+    {
+        return __atomic_load_n(&_steals, __ATOMIC_RELAXED);
+    }
+
+    // false if the bins were too small for the last record, every tile looked at every op
+    bool getBinned()
+    {
+        return _binned;
+    }
+
+private:
+    struct Worker
+    {
+        TileRenderer *renderer = NULL;
+        uint8_t index = 0;
+        Task task;
+        Signal wake;
+    };
+
+    // what the threads do in run()
+    enum
+    {
+        COUNTOPS,
+        BINOPS,
+        DRAWTILES
+    };
+
+    Worker _workers[MAXRENDERTHREADS]; // 0 is the thread calling render()
+    uint8_t _threads = 1;
+    uint8_t _step = DRAWTILES;
+    bool _stop = false;
+    Signal _done;
+    uint32_t _steals = 0;
+
+    uint16_t *_bins;
+    uint32_t _entries;
+    bool _binned = false;
+    // ops of tile t: _bins[_start[t]] .. _bins[_start[t + 1] - 1]
+    uint32_t _start[MAXRENDERTILES + 1];
+    // per thread: ops of its part in every tile, then where they go in _bins
+    uint32_t _bin[MAXRENDERTHREADS][MAXRENDERTILES];
+
+    // tiles not drawn yet of every thread: first in the low, end in the high 16 bits
+    uint32_t _runs[MAXRENDERTHREADS];
+
+    const FrameRecord *_record = NULL;
+    uint16_t *_frame = NULL;
+    int16_t _width = 0;
+    int16_t _height = 0;
+    uint8_t _shift = 0; // tiles of 1 << _shift pixels
+    uint16_t _columns = 0;
+    uint16_t _tiles = 0;
+
+    static void work(void *worker)
+    {
+        Worker *w = (Worker *)worker;
+        TileRenderer *r = w->renderer;
+        while (true)
+        {
+            w->wake.take();
+            if (r->_stop)
+                return;
+            r->step(w->index);
+            r->_done.give();
+        }
+    }
+
+    // tiles an op touches, false if none
+    bool tilesOf(const FrameOp &op, uint16_t &x0, uint16_t &y0, uint16_t &x1, uint16_t &y1)
+    {
+        int16_t right = min(op.x + op.w, (int)_width) - 1;
+        int16_t bottom = min(op.y + op.h, (int)_height) - 1;
+        if (op.w <= 0 || op.h <= 0 || right < 0 || bottom < 0 || op.x >= _width || op.y >= _height)
+            return false;
+        x0 = max((int)op.x, 0) >> _shift;
+        y0 = max((int)op.y, 0) >> _shift;
+        x1 = right >> _shift;
+        y1 = bottom >> _shift;
+        return true;
+    }
+
+    // all threads do step, returns when they are done
+    void run(uint8_t step)
+    {
+        _step = step;
+        for (uint8_t i = 1; i < _threads; i++)
+            _workers[i].wake.give();
+        this->step(0);
+        for (uint8_t i = 1; i < _threads; i++)
+            _done.take();
+    }
+
+    void step(uint8_t self)
+    {
+        if (_step == DRAWTILES)
+        {
+            drawTiles(self);
+            return;
+        }
+
+        // the part of the ops of this thread
+        const FrameOp *ops = _record->ops;
+        uint16_t first = (uint32_t)_record->count * self / _threads;
+        uint16_t end = (uint32_t)_record->count * (self + 1) / _threads;
+        uint32_t *bin = _bin[self];
+        uint16_t *bins = _bins;
+        uint16_t columns = _columns;
+        if (_step == COUNTOPS)
+            memset(bin, 0, _tiles * sizeof(uint32_t));
+
+        uint16_t x0, y0, x1, y1;
+        for (uint16_t i = first; i < end; i++)
+        {
+            if (!tilesOf(ops[i], x0, y0, x1, y1))
+                continue;
+            for (uint16_t ty = y0; ty <= y1; ty++)
+            {
+                for (uint16_t tx = x0; tx <= x1; tx++)
+                {
+                    if (_step == COUNTOPS)
+                        bin[ty * columns + tx]++;
+                    else
+                        bins[bin[ty * columns + tx]++] = i;
+                }
+            }
+        }
+    }
+
+    // own tiles first, then the ones of the others
+    void drawTiles(uint8_t self)
+    {
+        uint16_t tile;
+        while (takeFirst(self, tile))
+            drawTile(tile);
+
+        while (true)
+        {
+            // the run with the most tiles left
+            uint8_t victim = self;
+            uint16_t left = 0;
+            for (uint8_t i = 0; i < _threads; i++)
+            {
+                uint32_t run = __atomic_load_n(&_runs[i], __ATOMIC_RELAXED);
+                uint16_t first = run & 0xFFFF, end = run >> 16;
+                if (end > first && end - first > left)
+                {
+                    victim = i;
+                    left = end - first;
+                }
+            }
+            if (left == 0)
+                return;
+            if (takeLast(victim, tile))
+            {
+                drawTile(tile);
+                __atomic_fetch_add(&_steals, 1, __ATOMIC_RELAXED);
+            }
+        }
+    }
+
+    // the owner takes tiles from the front of its run, the others from the back
+    bool takeFirst(uint8_t thread, uint16_t &tile)
+    {
+        uint32_t run = __atomic_load_n(&_runs[thread], __ATOMIC_RELAXED);
+        while (true)
+        {
+            uint16_t first = run & 0xFFFF, end = run >> 16;
+            if (first >= end)
+                return false;
+            if (__atomic_compare_exchange_n(&_runs[thread], &run, run + 1, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                tile = first;
+                return true;
+            }
+        }
+    }
+
+    bool takeLast(uint8_t thread, uint16_t &tile)
+    {
+        uint32_t run = __atomic_load_n(&_runs[thread], __ATOMIC_RELAXED);
+        while (true)
+        {
+            uint16_t first = run & 0xFFFF, end = run >> 16;
+            if (first >= end)
+                return false;
+            if (__atomic_compare_exchange_n(&_runs[thread], &run, run - (1UL << 16), false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                tile = end - 1;
+                return true;
+            }
+        }
+    }
+
+    void drawTile(uint16_t tile)
+    {
+        int16_t left = (tile % _columns) << _shift;
+        int16_t top = (tile / _columns) << _shift;
+        int16_t right = min(left + (1 << _shift), (int)_width);
+        int16_t bottom = min(top + (1 << _shift), (int)_height);
+
+        const FrameOp *ops = _record->ops;
+        const uint16_t *pixels = _record->pixels;
+        const uint16_t *bins = _binned ? _bins : NULL;
+        uint16_t *frame = _frame;
+        int16_t width = _width;
+        uint32_t first = bins != NULL ? _start[tile] : 0;
+        uint32_t end = bins != NULL ? _start[tile + 1] : _record->count;
+        for (uint32_t k = first; k < end; k++)
+        {
+            const FrameOp op = ops[bins != NULL ? bins[k] : k];
+            int16_t x0 = max(op.x, left);
+            int16_t y0 = max(op.y, top);
+            int16_t x1 = min(op.x + op.w, (int)right);
+            int16_t y1 = min(op.y + op.h, (int)bottom);
+            if (x0 >= x1 || y0 >= y1)
+                continue;
+
+            for (int16_t y = y0; y < y1; y++)
+            {
+                uint16_t *row = frame + (uint32_t)y * width + x0;
+                if (op.kind == FRAMERECT)
+                {
+                    uint16_t color = op.value;
+                    for (int16_t x = x0; x < x1; x++)
+                        *row++ = color;
+                }
+                else
+                    memcpy(row, pixels + op.value + (uint32_t)(y - op.y) * op.w + (x0 - op.x), (x1 - x0) * sizeof(uint16_t));
+            }
+        }
+    }
+};
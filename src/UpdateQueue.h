@@ -0,0 +1,133 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Lock-free mailbox for value and text updates from interrupts, timer callbacks or a second core.
+ * The producer posts, BUI::update() takes all posted updates over at the start of a frame, before anything is drawn.
+ *
+ * Every queue has one producer and one consumer (BUI) and needs no locks. Use one queue per producer:
+ *   ui.post(&bg1, value);       // the queue inside BUI, from one ISR or task
+ *   UpdateQueue timerQueue;     // another producer gets its own queue
+ *   ui.addUpdateQueue(&timerQueue);
+ *   timerQueue.post(&lblTime, (char *)"12:00"); // text is copied into the queue
+ */
+
+// updates per queue, power of 2
+#ifndef UPDATEQUEUESIZE
+#define UPDATEQUEUESIZE 16
+#endif
+
+// head and tail wrap around at 65536, which only keeps the slot with % if the size divides it
+static_assert(UPDATEQUEUESIZE > 0 && UPDATEQUEUESIZE <= 32768 && (UPDATEQUEUESIZE & (UPDATEQUEUESIZE - 1)) == 0,
+              "UPDATEQUEUESIZE must be a power of 2");
+
+// max chars of a posted text
+#ifndef UPDATETEXTLEN
+#define UPDATETEXTLEN 24
+#endif
+
+class Control;
+class Observable;
+
+class UpdateQueue
+{
+public:
+    // returns false if the queue is full (the update is dropped)
+    bool post(Control *control, float value)
+    {
+        message *m = slot();
+        if (m == NULL)
+            return false;
+        m->kind = VALUE;
+        m->target = control;
+        m->value = value;
+        return push();
+    }
+
+    bool post(Control *control, const char *text)
+    {
+        message *m = slot();
+        if (m == NULL)
+            return false;
+        m->kind = TEXT;
+        m->target = control;
+        size_t n = strnlen(text, UPDATETEXTLEN);
+        memcpy(m->text, text, n);
+        m->text[n] = '\0';
+        return push();
+    }
+
+    bool post(Observable *observable, float value)
+    {
+        message *m = slot();
+        if (m == NULL)
+            return false;
+        m->kind = OBSERVABLE;
+        m->target = observable;
+        m->value = value;
+        return push();
+    }
+
+    // updates dropped because the queue was full
+    uint32_t dropped()
+    {
+        return __atomic_load_n(&_dropped, __ATOMIC_RELAXED);
+    }
+
+private:
+    friend class BUI;
+
+    enum
+    {
+        VALUE,
+        TEXT,
+        OBSERVABLE
+    };
+
+    struct message
+    {
+        uint8_t kind;
+        void *target;
+        float value;
+        char text[UPDATETEXTLEN + 1];
+    };
+
+    message _messages[UPDATEQUEUESIZE];
+    uint16_t _head = 0; // written by the producer only
+    uint16_t _tail = 0; // written by the consumer only
+    uint32_t _dropped = 0;
+
+    message *slot()
+    {
+        // the slot is read by the consumer before it gives it back
+        if ((uint16_t)(_head - __atomic_load_n(&_tail, __ATOMIC_ACQUIRE)) >= UPDATEQUEUESIZE)
+        {
+            __atomic_store_n(&_dropped, _dropped + 1, __ATOMIC_RELAXED);
+            return NULL;
+        }
+        return &_messages[_head % UPDATEQUEUESIZE];
+    }
+
+    bool push()
+    {
+        // message is written before it is published
+        __atomic_store_n(&_head, (uint16_t)(_head + 1), __ATOMIC_RELEASE);
+        return true;
+    }
+
+    // oldest message or NULL, release it with pop()
+    message *front()
+    {
+        // message is read after head
+        if (_tail == __atomic_load_n(&_head, __ATOMIC_ACQUIRE))
+            return NULL;
+        return &_messages[_tail % UPDATEQUEUESIZE];
+    }
+
+    void pop()
+    {
+        // message is read before the slot is given back
+        __atomic_store_n(&_tail, (uint16_t)(_tail + 1), __ATOMIC_RELEASE);
+    }
+};
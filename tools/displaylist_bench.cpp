@@ -0,0 +1,145 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Host benchmark of the display list (NOFRAMEBUFFER with DISPLAYLIST, src/DisplayList.h) with the example sketch
+ * (example/ui_test.ino) on the host display: both screens, text typed into the TextBox, the slider moving the
+ * graphs and dark mode. Every shape is sent straight away first (no setBuffer), then through the 400 ops of the
+ * sketch. Prints the windows recorded and sent by the list and the address windows and pixels sent to the panel.
+ *
+ *   g++ -std=gnu++17 -O2 -pthread -Itools/host -Isrc -o displaylist_bench tools/displaylist_bench.cpp && ./displaylist_bench
+ *
+ * Both runs start the sketch from the beginning, each one in its own process. setup() calibrates the touch screen
+ * (a touch is held for it, 2 seconds of delays); the sketch is driven through its handlers and values, not by
+ * touches, so every run draws the same frames. SPI bytes are 2 per pixel plus 11 per address window.
+ */
+
+#define NOFRAMEBUFFER
+#define DISPLAYLIST
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+// prototypes, the Arduino IDE generates them
+void btn1_onClickHandler();
+void btnMain_onClickHandler();
+void cb2_onClickHandler();
+void tb1_onClickHandler();
+void np1_onClickHandler();
+void getMainScreen();
+void get2ndScreen();
+
+#include "../example/ui_test.ino"
+
+#define WINDOWBYTES 11
+#define SPIMHZ 30
+
+static uint32_t frames = 0;
+
+// one loop() of the sketch, with a fixed ups so the label does not depend on the time of the host
+static void step(uint16_t count = 1)
+{
+    while (count--)
+    {
+        ups = 60;
+        loop();
+        frames++;
+    }
+}
+
+static void scenario()
+{
+    step(10);
+
+    // text typed on the NumPad, another option of the DropDown
+    tb1_onClickHandler();
+    step(5);
+    const char *digits[] = {"4", "2", "7", "1"};
+    for (const char *digit : digits)
+    {
+        tb1.addText((char *)digit);
+        step(3);
+    }
+    np1.enabled = false;
+    dd1.setSelectedIndex(2);
+    step(5);
+
+    // settings: the slider moves the BarGraph and the DonutGraph
+    btn1_onClickHandler();
+    step(5);
+    for (int i = 0; i <= 40; i++)
+    {
+        sl1Value = i * 132 / 40;
+        step();
+    }
+    for (int i = 0; i < 10; i++)
+    {
+        numUD.setValue(i - 5);
+        step();
+    }
+
+    // the same in dark mode
+    cb2.checked = true;
+    cb2_onClickHandler();
+    step(5);
+    for (int i = 40; i >= 0; i--)
+    {
+        sl1Value = i * 132 / 40;
+        step();
+    }
+    cb2.checked = false;
+    cb2_onClickHandler();
+    step(5);
+
+    btnMain_onClickHandler();
+    step(10);
+}
+
+static void run(bool list)
+{
+    // calibrateTouch() waits for a touch at each corner
+    ts.press(0, 0);
+    setup();
+    ts.release();
+    if (!list)
+        tft.setBuffer(NULL, 0);
+
+    uint32_t recorded = tft.getOpsRecorded();
+    uint32_t sent = tft.getOpsSent();
+    uint32_t windows = tft.windows;
+    uint32_t pixels = tft.pixelsSent;
+    scenario();
+
+    recorded = tft.getOpsRecorded() - recorded;
+    sent = tft.getOpsSent() - sent;
+    windows = tft.windows - windows;
+    pixels = tft.pixelsSent - pixels;
+    uint64_t bytes = (uint64_t)windows * WINDOWBYTES + (uint64_t)pixels * 2;
+    printf("%-14s %6u %9u %9u %9u %10u %11llu %8.1f\n", list ? "400 ops" : "none", frames, recorded, sent, windows,
+           pixels, (unsigned long long)bytes, bytes * 8.0 / (SPIMHZ * 1e6) * 1e3);
+    fflush(stdout);
+}
+
+int main()
+{
+    printf("example sketch, SPI at %d MHz\n\n", SPIMHZ);
+    printf("%-14s %6s %9s %9s %9s %10s %11s %8s\n", "display list", "frames", "recorded", "sent", "windows", "pixels",
+           "SPI bytes", "SPI ms");
+    fflush(stdout);
+
+    // the sketch keeps its state in globals, every run starts it in a new process
+    for (int list = 0; list <= 1; list++)
+    {
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            run(list);
+            return 0;
+        }
+        int status;
+        if (pid < 0 || waitpid(pid, &status, 0) != pid || status != 0)
+            return 1;
+    }
+    return 0;
+}
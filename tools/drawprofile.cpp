@@ -0,0 +1,140 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Host overdraw profile (DRAWPROFILE, src/DrawProfile.h) of a busy dashboard: the table of the pixels every control
+ * writes per frame and a heatmap of the writes per pixel, for BUI repainting every frame and for BUI drawing only
+ * the changes (enableRedrawOnChange).
+ *
+ *   g++ -std=gnu++17 -O2 -pthread -Itools/host -Isrc -o drawprofile tools/drawprofile.cpp && ./drawprofile
+ *   g++ -std=gnu++17 -O2 -pthread -DNOFRAMEBUFFER -Itools/host -Isrc -o drawprofile tools/drawprofile.cpp && ./drawprofile
+ *
+ * The second one draws in bands (setBandBuffer). Writes drawprofile_full.ppm and drawprofile_changes.ppm, the
+ * heatmaps of the last frame: not written dark gray, once blue, twice green, 3 yellow, 4 orange, more red.
+ * Owners are the controls in the order of addControl(), bg is what BUI draws itself.
+ *
+ * With framebuffer it checks that the bars (70 pixels apart, their scales do not overlap) and the chart below them
+ * draw their changes when only the changes are drawn, instead of being repainted whole: exits with 1 otherwise.
+ * In bands the chart is repainted whole (no framebuffer to scroll) and its tiles reach into the bars.
+ */
+
+#define DRAWPROFILE
+
+#include "ILI9486_t3n.h"
+#include "XPT2046_Touchscreen.h"
+#include "ili9486_t3n_font_Arial.h"
+#include "ili9486_t3n_font_ArialBold.h"
+#include "BUI.h"
+
+#define FRAMES 60
+#define BANDHEIGHT 40
+
+DisplayList tft(10, 9, 8);
+XPT2046_Touchscreen ts(7);
+
+// dashboard, the values change every frame
+float history[240];
+float levels[4];
+float load;
+float temperature;
+int32_t counter;
+
+BarGraph bars[4] = {
+    BarGraph(10, 10, 60, 150, 0, 100, 0x07E0, (char *)"A"),
+    BarGraph(80, 10, 60, 150, 0, 100, 0x001F, (char *)"B"),
+    BarGraph(150, 10, 60, 150, 0, 100, 0xF800, (char *)"C"),
+    BarGraph(220, 10, 60, 150, 0, 100, 0xFFE0, (char *)"D")};
+DonutGraph donut = DonutGraph(300, 10, 0, 100, 0x07FF, (char *)"Load");
+LineChart chart = LineChart(10, 180, 300, 130, history, 240, 0xF81F, (char *)"History");
+NumericLabel lblLoad = NumericLabel(330, 200, &load, 1, Arial_14);
+NumericLabel lblTemperature = NumericLabel(330, 230, &temperature, 2, Arial_14);
+NumericLabel lblCounter = NumericLabel(330, 260, &counter, 0, Arial_14);
+Slider slider = Slider(330, 290, 140, 24, 0, 100);
+Button button = Button(400, 200, 70, 30, (char *)"Reset");
+
+static uint32_t written[2][11]; // pixels of the owners in all frames of both runs
+static uint8_t counts[480 * 320];
+static uint8_t owners[480 * 320];
+#ifdef NOFRAMEBUFFER
+static uint16_t band[480 * BANDHEIGHT];
+#endif
+
+static void values(uint32_t frame)
+{
+    for (int i = 0; i < 4; i++)
+        levels[i] = 50 + 45 * sinf(frame * 0.05f * (i + 1));
+    load = 50 + 40 * sinf(frame * 0.031f);
+    temperature = 21.5f + 3 * cosf(frame * 0.017f);
+    counter = frame;
+
+    for (int i = 0; i < 4; i++)
+        bars[i].setValue(levels[i]);
+    donut.setValue(load);
+    slider.setValue(levels[0]);
+    chart.addSample(load);
+}
+
+static void run(const char *name, bool changesOnly, const char *heatmap)
+{
+    memset(history, 0, sizeof(history));
+    chart.clear();
+
+    BUI ui(&tft, &ts);
+    tft.setRotation(1);
+#ifdef NOFRAMEBUFFER
+    ui.setBandBuffer(band, BANDHEIGHT);
+#endif
+    ui.initNewScreen();
+    ui.enableRedrawOnChange(changesOnly);
+    for (int i = 0; i < 4; i++)
+        ui.addControl(&bars[i]);
+    ui.addControl(&donut);
+    ui.addControl(&chart);
+    ui.addControl(&lblLoad);
+    ui.addControl(&lblTemperature);
+    ui.addControl(&lblCounter);
+    ui.addControl(&slider);
+    ui.addControl(&button);
+
+    DrawProfile profile(counts, owners, 480, 320);
+    tft.setProfile(&profile);
+    // the first frame draws everything, it is left out of the table
+    values(0);
+    ui.update();
+    profile.clear();
+    for (uint32_t frame = 1; frame <= FRAMES; frame++)
+    {
+        values(frame);
+        ui.update();
+        for (uint8_t owner = 0; owner < 11; owner++)
+            written[changesOnly][owner] += profile.getWritten(owner);
+    }
+    tft.setProfile(NULL);
+
+    printf("\n%s, pixels per frame\n", name);
+    profile.printTable(Serial);
+    if (!profile.writeHeatmap(heatmap))
+        printf("%s not written\n", heatmap);
+}
+
+int main()
+{
+    printf("%d frames of a dashboard, owners: 0-3 bars, 4 donut, 5 chart, 6-8 labels, 9 slider, 10 button\n", FRAMES);
+    run("repaint every frame", false, "drawprofile_full.ppm");
+    run("redraw on change", true, "drawprofile_changes.ppm");
+
+#ifndef NOFRAMEBUFFER
+    // bars 0-3 and the chart 5 draw a few rows per frame, a whole repaint writes about 10 times more
+    bool incremental = true;
+    for (uint8_t owner = 0; owner <= 5; owner++)
+    {
+        if (owner != 4 && written[1][owner] * 4 > written[0][owner])
+            incremental = false;
+    }
+    printf("\nbars and chart draw their changes: %s\n", incremental ? "ok" : "FAILED");
+    return incremental ? 0 : 1;
+#else
+    return 0;
+#endif
+}
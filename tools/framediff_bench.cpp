@@ -0,0 +1,180 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Host benchmark of FrameDiff (src/FrameDiff.h): time of the diff against the SPI bytes it saves, for frames of
+ * typical dashboards on a 480x320 display. Every sent frame is checked against the frame it should show.
+ *
+ *   g++ -O2 -o framediff_bench tools/framediff_bench.cpp && ./framediff_bench
+ *
+ * SPI bytes are 2 per pixel plus 11 per address window (column, page and memory write command).
+ * The diff times are measured on the host (a Teensy is slower), the SPI time is computed for SPIMHZ.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#define WIDTH 480
+#define HEIGHT 320
+#define FRAMES 200
+#define WINDOWBYTES 11
+#define SPIMHZ 30
+
+// display with a framebuffer, counts what is sent
+class BenchDisplay
+{
+public:
+    uint16_t frame[WIDTH * HEIGHT];
+    uint16_t panel[WIDTH * HEIGHT];
+    uint64_t bytes = 0;
+
+    int16_t width()
+    {
+        return WIDTH;
+    }
+
+    int16_t height()
+    {
+        return HEIGHT;
+    }
+
+    void useFrameBuffer(bool enable)
+    {
+    }
+
+    void updateScreen()
+    {
+        memcpy(panel, frame, sizeof(panel));
+        bytes += WINDOWBYTES + sizeof(panel);
+    }
+
+    void writeRect(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pixels)
+    {
+        for (int16_t line = 0; line < h; line++)
+            memcpy(panel + (y + line) * WIDTH + x, pixels + line * w, w * sizeof(uint16_t));
+        bytes += WINDOWBYTES + (uint32_t)w * h * 2;
+    }
+};
+
+#define TFTLIB BenchDisplay
+#include "../src/FrameDiff.h"
+
+static void fillRect(uint16_t *frame, int x, int y, int w, int h, uint16_t color)
+{
+    for (int line = y; line < y + h; line++)
+        for (int i = x; i < x + w; i++)
+            frame[line * WIDTH + i] = color;
+}
+
+// glyph-like pattern for value, like a printed number
+static void text(uint16_t *frame, int x, int y, int w, int h, uint32_t value)
+{
+    fillRect(frame, x, y, w, h, 0xFFFF);
+    uint32_t seed = value * 2654435761UL + 1;
+    for (int line = y + 2; line < y + h - 2; line++)
+        for (int i = x; i < x + w; i++)
+        {
+            seed = seed * 1103515245 + 12345;
+            if ((seed >> 16) % 3 == 0)
+                frame[line * WIDTH + i] = 0x0000;
+        }
+}
+
+static void background(uint16_t *frame)
+{
+    fillRect(frame, 0, 0, WIDTH, HEIGHT, 0xFFFF);
+    fillRect(frame, 0, 0, WIDTH, 30, 0x001F);
+    for (int i = 0; i < 4; i++)
+        fillRect(frame, 20 + i * 115, 60, 100, 30, 0xEF7D);
+}
+
+// one frame of a dashboard
+typedef void (*Scene)(uint16_t *frame, int n);
+
+static void idle(uint16_t *frame, int n)
+{
+}
+
+static void clockText(uint16_t *frame, int n)
+{
+    text(frame, 400, 8, 70, 16, n);
+}
+
+static void gauges(uint16_t *frame, int n)
+{
+    for (int g = 0; g < 3; g++)
+    {
+        int level = (n * (g + 3) * 7) % 120;
+        fillRect(frame, 40 + g * 60, 120, 30, 120 - level, 0xFFFF);
+        fillRect(frame, 40 + g * 60, 240 - level, 30, level, 0x07E0);
+        text(frame, 36 + g * 60, 250, 40, 16, level);
+    }
+    clockText(frame, n);
+}
+
+static void chart(uint16_t *frame, int n)
+{
+    fillRect(frame, 160, 110, 300, 150, 0xFFFF);
+    for (int i = 0; i < 300; i++)
+    {
+        int v = ((i + n) * 37 % 101 + (i + n) * 13 % 47) % 140;
+        frame[(250 - v) * WIDTH + 160 + i] = 0xF800;
+    }
+    clockText(frame, n);
+}
+
+static void pages(uint16_t *frame, int n)
+{
+    fillRect(frame, 0, 30, WIDTH, HEIGHT - 30, n & 1 ? 0xFFFF : 0xC618);
+    text(frame, 20, 40 + (n % 10) * 20, 200, 16, n);
+}
+
+static void run(const char *name, Scene scene)
+{
+    static BenchDisplay display;
+    static uint16_t shadow[WIDTH * HEIGHT];
+    static uint32_t hashes[DIFFHASHES(WIDTH, HEIGHT)];
+    const uint64_t full = (uint64_t)FRAMES * (WINDOWBYTES + WIDTH * HEIGHT * 2);
+
+    for (int mode = 0; mode < 2; mode++)
+    {
+        FrameDiff diff = mode == 0 ? FrameDiff(shadow, WIDTH, HEIGHT) : FrameDiff(hashes, WIDTH, HEIGHT);
+        background(display.frame);
+        diff.send(&display, display.frame);
+        display.bytes = 0;
+
+        double seconds = 0;
+        int wrong = 0;
+        for (int n = 0; n < FRAMES; n++)
+        {
+            scene(display.frame, n);
+            auto start = std::chrono::steady_clock::now();
+            diff.send(&display, display.frame);
+            seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (memcmp(display.frame, display.panel, sizeof(display.panel)) != 0)
+                wrong++;
+        }
+
+        double spiSaved = (full - display.bytes) * 8.0 / (SPIMHZ * 1e6) / FRAMES * 1e3;
+        printf("%-8s %-6s %8.1f %12.0f %8.1f%% %12.2f %s\n", name, mode == 0 ? "shadow" : "hashes",
+               seconds / FRAMES * 1e6, (double)display.bytes / FRAMES, 100.0 * display.bytes / full, spiSaved,
+               wrong ? "WRONG" : "");
+    }
+}
+
+int main()
+{
+    printf("%dx%d, %d frames, SPI at %d MHz, shadow %u bytes, hashes %u bytes (DIFFSEGMENT %d)\n\n", WIDTH, HEIGHT,
+           FRAMES, SPIMHZ, (unsigned)(WIDTH * HEIGHT * 2), (unsigned)(DIFFHASHES(WIDTH, HEIGHT) * 4), DIFFSEGMENT);
+    printf("%-8s %-6s %8s %12s %9s %12s\n", "scene", "mode", "diff us", "bytes/frame", "of full", "SPI ms saved");
+    run("idle", idle);
+    run("clock", clockText);
+    run("gauges", gauges);
+    run("chart", chart);
+    run("pages", pages);
+    return 0;
+}
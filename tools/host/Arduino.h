@@ -0,0 +1,274 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Host backend: the parts of the Arduino core that Teensy_UI uses, for builds on Linux (benchmarks and tests in
+ * tools/). Time is the time of the host, Serial writes to stdout.
+ *
+ *   g++ -std=gnu++17 -O2 -pthread -Itools/host -Isrc sketch.cpp
+ */
+
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+
+#include <chrono>
+#include <math.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+
+#define PROGMEM
+#define F(text) (text)
+#define __disable_irq()
+#define __enable_irq()
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+template <class T>
+T min(T a, T b)
+{
+    return a < b ? a : b;
+}
+
+template <class T>
+T max(T a, T b)
+{
+    return a > b ? a : b;
+}
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax)
+{
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// ---------------------------------------------------------------- time
+
+inline std::chrono::steady_clock::time_point hostStart()
+{
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    return start;
+}
+
+inline unsigned long micros()
+{
+    return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - hostStart()).count();
+}
+
+inline unsigned long millis()
+{
+    return micros() / 1000;
+}
+
+inline void delayMicroseconds(uint32_t us)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+inline void delay(uint32_t ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+// ---------------------------------------------------------------- numbers to text
+
+// out has to take the digits, like with the functions of the core
+inline char *ltoa(long value, char *out, int radix)
+{
+    char buf[24];
+    int n = snprintf(buf, sizeof(buf), radix == 16 ? "%lx" : "%ld", value);
+    memcpy(out, buf, n + 1);
+    return out;
+}
+
+inline char *ultoa(unsigned long value, char *out, int radix)
+{
+    char buf[24];
+    int n = snprintf(buf, sizeof(buf), radix == 16 ? "%lx" : "%lu", value);
+    memcpy(out, buf, n + 1);
+    return out;
+}
+
+inline char *itoa(int value, char *out, int radix)
+{
+    return ltoa(value, out, radix);
+}
+
+inline char *dtostrf(double value, signed char width, unsigned char decimals, char *out)
+{
+    sprintf(out, "%*.*f", width, decimals, value);
+    return out;
+}
+
+// ---------------------------------------------------------------- String
+
+// only what the sketches and Teensy_UI use of it
+class String
+{
+public:
+    String(const char *text = "")
+    {
+        set(text);
+    }
+
+    String(const String &other)
+    {
+        set(other._text);
+    }
+
+    String &operator=(const String &other)
+    {
+        if (this != &other)
+            set(other._text);
+        return *this;
+    }
+
+    ~String()
+    {
+        free(_text);
+    }
+
+    const char *c_str() const
+    {
+        return _text;
+    }
+
+    unsigned int length() const
+    {
+        return strlen(_text);
+    }
+
+private:
+    char *_text = NULL;
+
+    void set(const char *text)
+    {
+        char *copy = strdup(text != NULL ? text : "");
+        free(_text);
+        _text = copy;
+    }
+};
+
+// ---------------------------------------------------------------- Print
+
+class Print
+{
+public:
+    virtual size_t write(uint8_t c) = 0;
+
+    virtual size_t write(const uint8_t *buffer, size_t size)
+    {
+        size_t n = 0;
+        while (size--)
+            n += write(*buffer++);
+        return n;
+    }
+
+    size_t write(const char *text)
+    {
+        return write((const uint8_t *)text, strlen(text));
+    }
+
+    size_t print(const char *text)
+    {
+        return write(text);
+    }
+
+    size_t print(const String &text)
+    {
+        return write(text.c_str());
+    }
+
+    size_t print(char c)
+    {
+        return write((uint8_t)c);
+    }
+
+    size_t print(long value)
+    {
+        char buf[24];
+        return print(ltoa(value, buf, 10));
+    }
+
+    size_t print(int value)
+    {
+        return print((long)value);
+    }
+
+    size_t print(unsigned long value)
+    {
+        char buf[24];
+        return print(ultoa(value, buf, 10));
+    }
+
+    size_t print(unsigned int value)
+    {
+        return print((unsigned long)value);
+    }
+
+    size_t print(double value, int decimals = 2)
+    {
+        char buf[48];
+        snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+        return print(buf);
+    }
+
+    size_t println()
+    {
+        return write('\n');
+    }
+
+    template <class T>
+    size_t println(T value)
+    {
+        size_t n = print(value);
+        return n + println();
+    }
+
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+    {
+        char buf[256];
+        va_list args;
+        va_start(args, format);
+        int n = vsnprintf(buf, sizeof(buf), format, args);
+        va_end(args);
+        print(buf);
+        return n;
+    }
+};
+
+class HardwareSerial : public Print
+{
+public:
+    void begin(long baud)
+    {
+    }
+
+    size_t write(uint8_t c) override
+    {
+        return fputc(c, stdout) == EOF ? 0 : 1;
+    }
+
+    size_t write(const uint8_t *buffer, size_t size) override
+    {
+        return fwrite(buffer, 1, size, stdout);
+    }
+
+    using Print::write;
+};
+
+inline HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,372 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Host backend: fonts in the ILI9341_t3 format with the sizes (cap height, line space) of Arial 10 to 32, generated
+ * as outline boxes with a pattern per char, so texts measure and draw like real ones and every char looks different.
+ * The ili9486_t3n_font_Arial*.h headers of the host backend name them like the fonts of the library.
+ */
+
+#ifndef _HOST_FONT_H_
+#define _HOST_FONT_H_
+
+#include "ILI9486_t3n.h"
+
+static const unsigned char HostFont_10_index[] = {
+    0, 0, 0, 4, 0, 8, 0, 13, 0, 21, 0, 29, 0, 39, 0, 46, 0, 50, 0, 58, 0, 66, 0, 72, 0, 78, 0, 82, 0, 87, 0,
+    91, 0, 99, 0, 107, 0, 111, 0, 119, 0, 127, 0, 135, 0, 142, 0, 150, 0, 158, 0, 166, 0, 172, 0, 176, 0, 180,
+    0, 188, 0, 193, 0, 201, 0, 209, 0, 219, 0, 227, 0, 235, 0, 243, 0, 250, 1, 2, 1, 10, 1, 18, 1, 24, 1, 30,
+    1, 36, 1, 44, 1, 52, 1, 62, 1, 70, 1, 78, 1, 86, 1, 94, 1, 102, 1, 109, 1, 117, 1, 125, 1, 133, 1, 140, 1,
+    146, 1, 152, 1, 160, 1, 168, 1, 176, 1, 184, 1, 189, 1, 197, 1, 201, 1, 207, 1, 214, 1, 220, 1, 228, 1,
+    234, 1, 240, 1, 246, 1, 252, 2, 0, 2, 7, 2, 15, 2, 19, 2, 26, 2, 32, 2, 38, 2, 45, 2, 51, 2, 57, 2, 63, 2,
+    71, 2, 77, 2, 83, 2, 90, 2, 96, 2, 103, 2, 109, 2, 117, 2, 121, 2, 129};
+
+static const unsigned char HostFont_10_data[] = {
+    0, 0, 0, 96, 1, 28, 0, 91, 4, 9, 40, 209, 224, 4, 29, 0, 207, 137, 91, 82, 240, 4, 29, 0, 207, 106, 210,
+    213, 188, 6, 29, 1, 15, 209, 177, 82, 149, 27, 240, 4, 29, 0, 207, 153, 106, 222, 1, 8, 40, 81, 4, 29, 0,
+    207, 74, 219, 18, 240, 4, 29, 0, 207, 92, 75, 82, 240, 4, 29, 0, 207, 185, 120, 4, 29, 0, 207, 189, 120, 1,
+    8, 248, 81, 4, 9, 16, 209, 224, 1, 8, 0, 81, 4, 29, 0, 207, 74, 210, 212, 188, 4, 29, 0, 207, 91, 82, 182,
+    188, 1, 28, 0, 91, 4, 29, 0, 207, 137, 91, 82, 240, 4, 29, 0, 207, 106, 210, 213, 188, 4, 29, 0, 207, 106,
+    226, 90, 240, 4, 29, 0, 207, 153, 106, 222, 4, 29, 0, 207, 106, 210, 213, 188, 4, 29, 0, 207, 137, 91, 82,
+    240, 4, 29, 0, 207, 92, 75, 82, 240, 4, 29, 0, 207, 185, 120, 1, 16, 0, 85, 1, 16, 248, 85, 4, 29, 0, 207,
+    91, 82, 182, 188, 4, 9, 16, 209, 224, 4, 29, 0, 207, 74, 210, 212, 188, 4, 29, 0, 207, 91, 82, 182, 188, 6,
+    29, 1, 15, 210, 169, 98, 141, 43, 240, 4, 29, 0, 207, 137, 91, 82, 240, 4, 29, 0, 207, 106, 210, 213, 188,
+    4, 29, 0, 207, 92, 75, 86, 240, 4, 29, 0, 207, 153, 106, 222, 4, 29, 0, 207, 106, 210, 213, 188, 4, 29, 0,
+    207, 108, 74, 218, 240, 4, 29, 0, 207, 92, 75, 82, 240, 4, 29, 0, 207, 185, 120, 4, 29, 0, 207, 185, 120,
+    4, 29, 0, 207, 189, 120, 4, 29, 0, 207, 91, 82, 182, 188, 4, 29, 0, 207, 90, 86, 149, 188, 6, 29, 1, 15,
+    208, 169, 70, 197, 43, 240, 4, 29, 0, 207, 91, 82, 182, 188, 4, 29, 0, 207, 137, 91, 82, 240, 4, 29, 0,
+    207, 137, 91, 82, 240, 4, 29, 0, 207, 106, 210, 213, 188, 4, 29, 0, 207, 137, 106, 210, 240, 4, 29, 0, 207,
+    153, 106, 222, 4, 29, 0, 207, 106, 210, 213, 188, 4, 29, 0, 207, 91, 98, 86, 240, 4, 29, 0, 207, 92, 75,
+    82, 240, 6, 29, 1, 15, 238, 87, 224, 4, 29, 0, 207, 185, 120, 4, 29, 0, 207, 189, 120, 4, 29, 0, 207, 91,
+    82, 182, 188, 4, 29, 0, 207, 75, 82, 212, 188, 4, 29, 0, 207, 74, 210, 212, 188, 4, 29, 0, 207, 91, 82,
+    182, 188, 4, 9, 40, 209, 224, 4, 29, 0, 207, 137, 91, 82, 240, 1, 8, 40, 81, 4, 17, 0, 207, 75, 94, 4, 29,
+    0, 207, 153, 106, 222, 4, 17, 0, 207, 106, 222, 4, 29, 0, 207, 74, 219, 18, 240, 4, 17, 0, 207, 90, 94, 4,
+    29, 0, 207, 185, 120, 4, 21, 248, 207, 157, 120, 4, 29, 0, 207, 189, 120, 1, 16, 0, 85, 4, 21, 248, 207,
+    74, 210, 240, 4, 29, 0, 207, 74, 210, 212, 188, 1, 28, 0, 91, 6, 17, 1, 15, 212, 177, 126, 4, 17, 0, 207,
+    137, 120, 4, 17, 0, 207, 106, 222, 4, 21, 248, 207, 106, 210, 240, 4, 21, 248, 207, 153, 120, 4, 17, 0,
+    207, 106, 222, 4, 17, 0, 207, 137, 120, 4, 29, 0, 207, 92, 75, 82, 240, 4, 17, 0, 207, 137, 120, 4, 17, 0,
+    207, 139, 120, 6, 17, 1, 15, 227, 23, 224, 4, 17, 0, 207, 91, 94, 4, 21, 248, 207, 106, 90, 240, 4, 17, 0,
+    207, 74, 222, 4, 29, 0, 207, 91, 82, 182, 188, 1, 28, 0, 91, 4, 29, 0, 207, 137, 91, 82, 240, 4, 9, 16,
+    209, 224};
+
+const ILI9486_t3_font_t HostFont_10 = {HostFont_10_index, 0, HostFont_10_data, 1, 0, 32, 126, 0, 0, 16, 5, 6, 2, 5, 6, 11, 7};
+
+static const unsigned char HostFont_12_index[] = {
+    0, 0, 0, 4, 0, 8, 0, 14, 0, 24, 0, 35, 0, 49, 0, 59, 0, 63, 0, 74, 0, 85, 0, 91, 0, 97, 0, 101, 0, 106, 0,
+    110, 0, 121, 0, 132, 0, 136, 0, 146, 0, 157, 0, 168, 0, 178, 0, 189, 0, 200, 0, 211, 0, 217, 0, 221, 0,
+    225, 0, 236, 0, 241, 0, 252, 1, 7, 1, 21, 1, 31, 1, 42, 1, 53, 1, 63, 1, 74, 1, 85, 1, 96, 1, 102, 1, 108,
+    1, 114, 1, 125, 1, 136, 1, 150, 1, 161, 1, 172, 1, 182, 1, 193, 1, 204, 1, 214, 1, 225, 1, 236, 1, 247, 1,
+    255, 2, 5, 2, 11, 2, 22, 2, 33, 2, 44, 2, 55, 2, 61, 2, 71, 2, 75, 2, 83, 2, 93, 2, 101, 2, 112, 2, 120, 2,
+    126, 2, 132, 2, 138, 2, 142, 2, 152, 2, 163, 2, 167, 2, 178, 2, 186, 2, 194, 2, 204, 2, 213, 2, 221, 2,
+    229, 2, 240, 2, 246, 2, 252, 3, 4, 3, 12, 3, 22, 3, 30, 3, 41, 3, 45, 3, 55};
+
+static const unsigned char HostFont_12_data[] = {
+    0, 0, 0, 96, 1, 36, 0, 95, 5, 13, 48, 239, 162, 248, 5, 37, 0, 239, 162, 154, 172, 196, 83, 124, 5, 37, 0,
+    239, 178, 170, 108, 170, 155, 47, 128, 8, 37, 1, 79, 244, 75, 21, 70, 145, 68, 177, 84, 111, 240, 5, 37, 0,
+    239, 167, 17, 101, 84, 209, 124, 1, 12, 48, 83, 5, 37, 0, 239, 166, 171, 40, 166, 171, 47, 128, 5, 37, 0,
+    239, 170, 138, 108, 162, 170, 47, 128, 5, 37, 0, 239, 236, 223, 5, 37, 0, 239, 238, 95, 1, 8, 240, 81, 5,
+    9, 24, 241, 240, 1, 8, 0, 81, 5, 37, 0, 239, 162, 170, 44, 166, 138, 175, 128, 5, 37, 0, 239, 170, 202,
+    106, 178, 154, 175, 128, 1, 36, 0, 95, 5, 37, 0, 239, 162, 154, 172, 196, 83, 124, 5, 37, 0, 239, 178, 170,
+    108, 170, 155, 47, 128, 5, 37, 0, 239, 178, 170, 104, 178, 170, 111, 128, 5, 37, 0, 239, 167, 17, 101, 84,
+    209, 124, 5, 37, 0, 239, 178, 170, 108, 170, 155, 47, 128, 5, 37, 0, 239, 162, 154, 172, 162, 154, 175,
+    128, 5, 37, 0, 239, 170, 138, 108, 162, 170, 47, 128, 5, 37, 0, 239, 236, 223, 1, 24, 0, 89, 1, 24, 240,
+    89, 5, 37, 0, 239, 170, 202, 106, 178, 154, 175, 128, 5, 9, 24, 241, 240, 5, 37, 0, 239, 162, 170, 44, 166,
+    138, 175, 128, 5, 37, 0, 239, 170, 202, 106, 178, 154, 175, 128, 8, 37, 1, 79, 244, 138, 141, 138, 137, 72,
+    168, 216, 175, 240, 5, 37, 0, 239, 162, 154, 172, 196, 83, 124, 5, 37, 0, 239, 178, 170, 108, 170, 155, 47,
+    128, 5, 37, 0, 239, 170, 154, 44, 170, 154, 47, 128, 5, 37, 0, 239, 167, 17, 101, 84, 209, 124, 5, 37, 0,
+    239, 178, 170, 108, 170, 155, 47, 128, 5, 37, 0, 239, 178, 138, 106, 178, 138, 111, 128, 5, 37, 0, 239,
+    170, 138, 108, 162, 170, 47, 128, 5, 37, 0, 239, 236, 223, 5, 37, 0, 239, 236, 223, 5, 37, 0, 239, 238, 95,
+    5, 37, 0, 239, 170, 202, 106, 178, 154, 175, 128, 5, 37, 0, 239, 170, 138, 168, 170, 138, 175, 128, 8, 37,
+    1, 79, 244, 42, 133, 18, 195, 72, 161, 84, 47, 240, 5, 37, 0, 239, 170, 202, 106, 178, 154, 175, 128, 5,
+    37, 0, 239, 162, 154, 172, 162, 154, 175, 128, 5, 37, 0, 239, 162, 154, 172, 196, 83, 124, 5, 37, 0, 239,
+    178, 170, 108, 170, 155, 47, 128, 5, 37, 0, 239, 166, 139, 42, 166, 139, 47, 128, 5, 37, 0, 239, 167, 17,
+    101, 84, 209, 124, 5, 37, 0, 239, 178, 170, 108, 170, 155, 47, 128, 5, 37, 0, 239, 170, 202, 41, 170, 202,
+    47, 128, 5, 37, 0, 239, 170, 138, 108, 162, 170, 47, 128, 8, 37, 1, 79, 253, 147, 127, 128, 5, 37, 0, 239,
+    236, 95, 5, 37, 0, 239, 238, 95, 5, 37, 0, 239, 170, 202, 106, 178, 154, 175, 128, 5, 37, 0, 239, 166, 202,
+    108, 166, 202, 111, 128, 5, 37, 0, 239, 162, 170, 44, 166, 138, 175, 128, 5, 37, 0, 239, 170, 202, 106,
+    178, 154, 175, 128, 5, 13, 48, 239, 162, 248, 5, 37, 0, 239, 162, 154, 172, 196, 83, 124, 1, 12, 48, 83, 5,
+    25, 0, 239, 162, 202, 169, 190, 5, 37, 0, 239, 167, 17, 101, 84, 209, 124, 5, 25, 0, 239, 178, 170, 108,
+    190, 5, 37, 0, 239, 166, 171, 40, 166, 171, 47, 128, 5, 25, 0, 239, 170, 138, 108, 190, 5, 37, 0, 239, 236,
+    223, 5, 33, 240, 239, 230, 95, 5, 37, 0, 239, 238, 95, 1, 24, 0, 89, 5, 33, 240, 239, 162, 170, 42, 162,
+    171, 224, 5, 37, 0, 239, 162, 170, 44, 166, 138, 175, 128, 1, 36, 0, 95, 8, 25, 1, 79, 245, 27, 21, 18,
+    145, 127, 128, 5, 25, 0, 239, 162, 154, 172, 190, 5, 25, 0, 239, 178, 170, 108, 190, 5, 33, 240, 239, 178,
+    170, 104, 178, 171, 224, 5, 33, 240, 239, 167, 17, 101, 84, 223, 5, 25, 0, 239, 178, 170, 108, 190, 5, 25,
+    0, 239, 162, 154, 172, 190, 5, 37, 0, 239, 170, 138, 108, 162, 170, 47, 128, 5, 25, 0, 239, 212, 223, 5,
+    25, 0, 239, 213, 95, 8, 25, 1, 79, 250, 195, 127, 128, 5, 25, 0, 239, 170, 202, 106, 190, 5, 33, 240, 239,
+    178, 155, 41, 178, 155, 224, 5, 25, 0, 239, 162, 170, 44, 190, 5, 37, 0, 239, 170, 202, 106, 178, 154, 175,
+    128, 1, 36, 0, 95, 5, 37, 0, 239, 162, 154, 172, 196, 83, 124, 5, 9, 24, 241, 240};
+
+const ILI9486_t3_font_t HostFont_12 = {HostFont_12_index, 0, HostFont_12_data, 1, 0, 32, 126, 0, 0, 16, 5, 6, 2, 5, 6, 14, 9};
+
+static const unsigned char HostFont_14_index[] = {
+    0, 0, 0, 4, 0, 9, 0, 15, 0, 28, 0, 41, 0, 57, 0, 70, 0, 75, 0, 88, 0, 101, 0, 108, 0, 115, 0, 120, 0, 125,
+    0, 130, 0, 143, 0, 156, 0, 161, 0, 174, 0, 187, 0, 200, 0, 213, 0, 226, 0, 239, 0, 252, 1, 3, 1, 8, 1, 13,
+    1, 26, 1, 31, 1, 44, 1, 57, 1, 73, 1, 86, 1, 99, 1, 112, 1, 125, 1, 138, 1, 151, 1, 164, 1, 171, 1, 178, 1,
+    185, 1, 198, 1, 211, 1, 227, 1, 240, 1, 253, 2, 10, 2, 23, 2, 36, 2, 49, 2, 62, 2, 75, 2, 88, 2, 96, 2,
+    103, 2, 110, 2, 123, 2, 136, 2, 149, 2, 162, 2, 168, 2, 181, 2, 186, 2, 196, 2, 209, 2, 219, 2, 232, 2,
+    242, 2, 249, 3, 0, 3, 7, 3, 12, 3, 24, 3, 37, 3, 42, 3, 55, 3, 65, 3, 75, 3, 87, 3, 99, 3, 109, 3, 119, 3,
+    132, 3, 139, 3, 146, 3, 154, 3, 164, 3, 176, 3, 186, 3, 199, 3, 204, 3, 217};
+
+static const unsigned char HostFont_14_data[] = {
+    0, 0, 0, 96, 2, 40, 0, 127, 176, 6, 13, 57, 15, 208, 191, 6, 41, 1, 15, 209, 165, 82, 197, 10, 52, 170, 95,
+    128, 6, 41, 1, 15, 217, 169, 74, 205, 74, 86, 106, 95, 128, 9, 41, 1, 111, 250, 34, 196, 168, 169, 26, 34,
+    196, 168, 169, 27, 254, 6, 41, 1, 15, 210, 163, 66, 197, 74, 84, 104, 95, 128, 2, 12, 56, 115, 128, 6, 41,
+    1, 15, 210, 169, 98, 141, 42, 150, 40, 223, 128, 6, 41, 1, 15, 212, 161, 74, 197, 26, 148, 41, 95, 128, 6,
+    41, 1, 15, 250, 87, 224, 6, 41, 1, 15, 251, 23, 224, 2, 8, 240, 113, 128, 6, 9, 25, 17, 248, 2, 8, 0, 113,
+    128, 6, 41, 1, 15, 208, 169, 70, 197, 42, 21, 40, 223, 128, 6, 41, 1, 15, 212, 179, 74, 165, 154, 85, 44,
+    223, 128, 2, 40, 0, 127, 176, 6, 41, 1, 15, 209, 165, 82, 197, 10, 52, 170, 95, 128, 6, 41, 1, 15, 217,
+    169, 74, 205, 74, 86, 106, 95, 128, 6, 41, 1, 15, 216, 169, 74, 141, 138, 148, 168, 223, 128, 6, 41, 1, 15,
+    210, 163, 66, 197, 74, 84, 104, 95, 128, 6, 41, 1, 15, 217, 169, 74, 205, 74, 86, 106, 95, 128, 6, 41, 1,
+    15, 209, 165, 82, 197, 26, 85, 44, 95, 128, 6, 41, 1, 15, 212, 161, 74, 197, 26, 148, 41, 95, 128, 6, 41,
+    1, 15, 250, 87, 224, 2, 28, 0, 123, 128, 2, 28, 240, 123, 128, 6, 41, 1, 15, 212, 179, 74, 165, 154, 85,
+    44, 223, 128, 6, 9, 25, 17, 248, 6, 41, 1, 15, 208, 169, 70, 197, 42, 21, 40, 223, 128, 6, 41, 1, 15, 212,
+    179, 74, 165, 154, 85, 44, 223, 128, 9, 41, 1, 111, 250, 70, 162, 177, 40, 138, 70, 162, 177, 40, 139, 254,
+    6, 41, 1, 15, 209, 165, 82, 197, 10, 52, 170, 95, 128, 6, 41, 1, 15, 217, 169, 74, 205, 74, 86, 106, 95,
+    128, 6, 41, 1, 15, 212, 165, 70, 197, 74, 84, 108, 95, 128, 6, 41, 1, 15, 210, 163, 66, 197, 74, 84, 104,
+    95, 128, 6, 41, 1, 15, 217, 169, 74, 205, 74, 86, 106, 95, 128, 6, 41, 1, 15, 216, 163, 74, 165, 138, 52,
+    170, 95, 128, 6, 41, 1, 15, 212, 161, 74, 197, 26, 148, 41, 95, 128, 6, 41, 1, 15, 250, 87, 224, 6, 41, 1,
+    15, 250, 87, 224, 6, 41, 1, 15, 251, 23, 224, 6, 41, 1, 15, 212, 179, 74, 165, 154, 85, 44, 223, 128, 6,
+    41, 1, 15, 212, 163, 82, 141, 74, 53, 40, 223, 128, 9, 41, 1, 111, 250, 18, 161, 162, 44, 42, 66, 132, 168,
+    104, 139, 254, 6, 41, 1, 15, 212, 179, 74, 165, 154, 85, 44, 223, 128, 6, 41, 1, 15, 209, 165, 82, 197, 26,
+    85, 44, 95, 128, 6, 41, 1, 15, 209, 165, 82, 197, 10, 52, 170, 95, 128, 6, 41, 1, 15, 217, 169, 74, 205,
+    74, 86, 106, 95, 128, 6, 41, 1, 15, 210, 163, 98, 165, 42, 54, 42, 95, 128, 6, 41, 1, 15, 210, 163, 66,
+    197, 74, 84, 104, 95, 128, 6, 41, 1, 15, 217, 169, 74, 205, 74, 86, 106, 95, 128, 6, 41, 1, 15, 212, 177,
+    70, 149, 75, 20, 105, 95, 128, 6, 41, 1, 15, 212, 161, 74, 197, 26, 148, 41, 95, 128, 9, 41, 1, 111, 255,
+    73, 95, 240, 6, 41, 1, 15, 250, 55, 224, 6, 41, 1, 15, 251, 23, 224, 6, 41, 1, 15, 212, 179, 74, 165, 154,
+    85, 44, 223, 128, 6, 41, 1, 15, 210, 177, 74, 197, 43, 20, 172, 95, 128, 6, 41, 1, 15, 208, 169, 70, 197,
+    42, 21, 40, 223, 128, 6, 41, 1, 15, 212, 179, 74, 165, 154, 85, 44, 223, 128, 6, 13, 57, 15, 208, 191, 6,
+    41, 1, 15, 209, 165, 82, 197, 10, 52, 170, 95, 128, 2, 12, 56, 115, 128, 6, 29, 1, 15, 209, 177, 82, 149,
+    27, 240, 6, 41, 1, 15, 210, 163, 66, 197, 74, 84, 104, 95, 128, 6, 29, 1, 15, 217, 169, 74, 205, 75, 240,
+    6, 41, 1, 15, 210, 169, 98, 141, 42, 150, 40, 223, 128, 6, 29, 1, 15, 212, 161, 74, 197, 27, 240, 6, 41, 1,
+    15, 250, 87, 224, 6, 37, 241, 15, 247, 23, 224, 6, 41, 1, 15, 251, 23, 224, 2, 28, 0, 123, 128, 6, 37, 241,
+    15, 209, 169, 70, 165, 26, 148, 111, 192, 6, 41, 1, 15, 208, 169, 70, 197, 42, 21, 40, 223, 128, 2, 40, 0,
+    127, 176, 9, 29, 1, 111, 250, 138, 196, 162, 41, 26, 138, 255, 128, 6, 29, 1, 15, 209, 165, 82, 197, 11,
+    240, 6, 29, 1, 15, 217, 169, 74, 205, 75, 240, 6, 37, 241, 15, 216, 169, 74, 141, 138, 148, 175, 192, 6,
+    37, 241, 15, 210, 163, 66, 197, 74, 84, 111, 192, 6, 29, 1, 15, 217, 169, 74, 205, 75, 240, 6, 29, 1, 15,
+    209, 165, 82, 197, 27, 240, 6, 41, 1, 15, 212, 161, 74, 197, 26, 148, 41, 95, 128, 6, 29, 1, 15, 238, 87,
+    224, 6, 29, 1, 15, 238, 151, 224, 9, 29, 1, 111, 253, 225, 95, 240, 6, 29, 1, 15, 212, 179, 74, 165, 155,
+    240, 6, 37, 241, 15, 216, 165, 98, 149, 138, 86, 47, 192, 6, 29, 1, 15, 208, 169, 70, 197, 43, 240, 6, 41,
+    1, 15, 212, 179, 74, 165, 154, 85, 44, 223, 128, 2, 40, 0, 127, 176, 6, 41, 1, 15, 209, 165, 82, 197, 10,
+    52, 170, 95, 128, 6, 9, 25, 17, 248};
+
+const ILI9486_t3_font_t HostFont_14 = {HostFont_14_index, 0, HostFont_14_data, 1, 0, 32, 126, 0, 0, 16, 5, 6, 2, 5, 6, 16, 10};
+
+static const unsigned char HostFont_20_index[] = {
+    0, 0, 0, 4, 0, 9, 0, 17, 0, 37, 0, 57, 0, 84, 0, 104, 0, 109, 0, 129, 0, 149, 0, 158, 0, 167, 0, 172, 0,
+    179, 0, 184, 0, 204, 0, 224, 0, 229, 0, 249, 1, 13, 1, 33, 1, 53, 1, 73, 1, 93, 1, 113, 1, 122, 1, 127, 1,
+    132, 1, 152, 1, 159, 1, 179, 1, 199, 1, 226, 1, 246, 2, 10, 2, 30, 2, 50, 2, 70, 2, 90, 2, 110, 2, 119, 2,
+    128, 2, 137, 2, 157, 2, 177, 2, 204, 2, 224, 2, 244, 3, 8, 3, 28, 3, 48, 3, 68, 3, 88, 3, 108, 3, 128, 3,
+    139, 3, 148, 3, 157, 3, 177, 3, 197, 3, 217, 3, 237, 3, 245, 4, 9, 4, 14, 4, 28, 4, 48, 4, 62, 4, 82, 4,
+    96, 4, 105, 4, 114, 4, 123, 4, 128, 4, 145, 4, 165, 4, 170, 4, 188, 4, 202, 4, 216, 4, 233, 4, 250, 5, 8,
+    5, 22, 5, 42, 5, 50, 5, 58, 5, 67, 5, 81, 5, 98, 5, 112, 5, 132, 5, 137, 5, 157};
+
+static const unsigned char HostFont_20_data[] = {
+    0, 0, 0, 128, 2, 56, 0, 127, 222, 8, 17, 81, 79, 246, 42, 37, 254, 8, 57, 1, 79, 244, 74, 69, 66, 195, 66,
+    162, 82, 42, 22, 26, 21, 18, 145, 127, 128, 8, 57, 1, 79, 246, 74, 149, 38, 201, 82, 164, 217, 42, 84, 155,
+    37, 74, 147, 127, 128, 12, 57, 1, 207, 255, 68, 75, 17, 84, 70, 145, 20, 68, 177, 21, 68, 105, 17, 68, 75,
+    17, 84, 70, 145, 23, 255, 128, 8, 57, 1, 79, 244, 138, 37, 10, 195, 80, 164, 81, 40, 86, 26, 133, 34, 137,
+    127, 128, 2, 16, 80, 117, 128, 8, 57, 1, 79, 244, 138, 141, 138, 137, 72, 168, 216, 168, 148, 138, 141,
+    138, 137, 127, 128, 8, 57, 1, 79, 245, 10, 21, 34, 195, 68, 168, 80, 169, 22, 26, 37, 66, 133, 127, 128, 8,
+    57, 1, 79, 255, 147, 153, 55, 248, 8, 57, 1, 79, 255, 197, 156, 87, 248, 2, 8, 232, 113, 128, 8, 13, 33,
+    79, 244, 11, 252, 2, 8, 0, 113, 128, 8, 57, 1, 79, 244, 42, 133, 18, 195, 72, 161, 84, 40, 150, 26, 69, 10,
+    161, 127, 128, 8, 57, 1, 79, 245, 43, 37, 38, 165, 100, 164, 212, 172, 148, 154, 149, 146, 147, 127, 128,
+    2, 56, 0, 127, 222, 8, 57, 1, 79, 244, 74, 69, 66, 195, 66, 162, 82, 42, 22, 26, 21, 18, 145, 127, 128, 8,
+    57, 1, 79, 246, 74, 149, 38, 201, 82, 164, 217, 42, 84, 155, 37, 74, 147, 127, 128, 8, 57, 1, 79, 246, 42,
+    141, 34, 137, 98, 168, 210, 40, 150, 42, 141, 34, 137, 127, 128, 8, 57, 1, 79, 244, 138, 37, 10, 195, 80,
+    164, 81, 40, 86, 26, 133, 34, 137, 127, 128, 8, 57, 1, 79, 246, 74, 149, 38, 201, 82, 164, 217, 42, 84,
+    155, 37, 74, 147, 127, 128, 8, 57, 1, 79, 244, 74, 69, 70, 197, 68, 164, 84, 108, 84, 74, 69, 70, 197, 127,
+    128, 8, 57, 1, 79, 245, 10, 21, 34, 195, 68, 168, 80, 169, 22, 26, 37, 66, 133, 127, 128, 8, 57, 1, 79,
+    255, 147, 153, 55, 248, 2, 36, 0, 127, 128, 2, 36, 232, 127, 128, 8, 57, 1, 79, 245, 43, 37, 38, 165, 100,
+    164, 212, 172, 148, 154, 149, 146, 147, 127, 128, 8, 13, 33, 79, 244, 11, 252, 8, 57, 1, 79, 244, 42, 133,
+    18, 195, 72, 161, 84, 40, 150, 26, 69, 10, 161, 127, 128, 8, 57, 1, 79, 245, 43, 37, 38, 165, 100, 164,
+    212, 172, 148, 154, 149, 146, 147, 127, 128, 12, 57, 1, 207, 255, 72, 138, 136, 216, 138, 136, 148, 136,
+    168, 141, 136, 168, 137, 72, 138, 136, 216, 138, 136, 151, 255, 128, 8, 57, 1, 79, 244, 74, 69, 66, 195,
+    66, 162, 82, 42, 22, 26, 21, 18, 145, 127, 128, 8, 57, 1, 79, 246, 74, 149, 38, 201, 82, 164, 217, 42, 84,
+    155, 37, 74, 147, 127, 128, 8, 57, 1, 79, 245, 26, 69, 18, 197, 81, 164, 81, 44, 85, 26, 69, 18, 197, 127,
+    128, 8, 57, 1, 79, 244, 138, 37, 10, 195, 80, 164, 81, 40, 86, 26, 133, 34, 137, 127, 128, 8, 57, 1, 79,
+    246, 74, 149, 38, 201, 82, 164, 217, 42, 84, 155, 37, 74, 147, 127, 128, 8, 57, 1, 79, 246, 42, 37, 34,
+    163, 98, 162, 82, 42, 54, 42, 37, 34, 163, 127, 128, 8, 57, 1, 79, 245, 10, 21, 34, 195, 68, 168, 80, 169,
+    22, 26, 37, 66, 133, 127, 128, 8, 57, 1, 79, 255, 147, 153, 55, 248, 8, 57, 1, 79, 255, 145, 153, 23, 248,
+    8, 57, 1, 79, 255, 195, 156, 55, 248, 8, 57, 1, 79, 245, 43, 37, 38, 165, 100, 164, 212, 172, 148, 154,
+    149, 146, 147, 127, 128, 8, 57, 1, 79, 245, 26, 37, 70, 137, 81, 162, 84, 104, 149, 26, 37, 70, 137, 127,
+    128, 12, 57, 1, 207, 255, 66, 26, 132, 81, 10, 194, 20, 132, 161, 13, 66, 40, 133, 97, 10, 66, 80, 134,
+    161, 23, 255, 128, 8, 57, 1, 79, 245, 43, 37, 38, 165, 100, 164, 212, 172, 148, 154, 149, 146, 147, 127,
+    128, 8, 57, 1, 79, 244, 74, 69, 70, 197, 68, 164, 84, 108, 84, 74, 69, 70, 197, 127, 128, 8, 57, 1, 79,
+    244, 74, 69, 66, 195, 66, 162, 82, 42, 22, 26, 21, 18, 145, 127, 128, 8, 57, 1, 79, 246, 74, 149, 38, 201,
+    82, 164, 217, 42, 84, 155, 37, 74, 147, 127, 128, 8, 57, 1, 79, 244, 138, 37, 138, 163, 72, 162, 88, 170,
+    52, 138, 37, 138, 163, 127, 128, 8, 57, 1, 79, 244, 138, 37, 10, 195, 80, 164, 81, 40, 86, 26, 133, 34,
+    137, 127, 128, 8, 57, 1, 79, 246, 74, 149, 38, 201, 82, 164, 217, 42, 84, 155, 37, 74, 147, 127, 128, 8,
+    57, 1, 79, 245, 27, 21, 18, 145, 81, 177, 81, 41, 21, 27, 21, 18, 145, 127, 128, 8, 57, 1, 79, 245, 10, 21,
+    34, 195, 68, 168, 80, 169, 22, 26, 37, 66, 133, 127, 128, 12, 57, 1, 207, 255, 249, 37, 153, 37, 127, 248,
+    8, 57, 1, 79, 255, 137, 152, 151, 248, 8, 57, 1, 79, 255, 195, 156, 55, 248, 8, 57, 1, 79, 245, 43, 37, 38,
+    165, 100, 164, 212, 172, 148, 154, 149, 146, 147, 127, 128, 8, 57, 1, 79, 244, 139, 21, 34, 197, 72, 177,
+    82, 44, 84, 139, 21, 34, 197, 127, 128, 8, 57, 1, 79, 244, 42, 133, 18, 195, 72, 161, 84, 40, 150, 26, 69,
+    10, 161, 127, 128, 8, 57, 1, 79, 245, 43, 37, 38, 165, 100, 164, 212, 172, 148, 154, 149, 146, 147, 127,
+    128, 8, 17, 81, 79, 246, 42, 37, 254, 8, 57, 1, 79, 244, 74, 69, 66, 195, 66, 162, 82, 42, 22, 26, 21, 18,
+    145, 127, 128, 2, 16, 80, 117, 128, 8, 37, 1, 79, 244, 75, 21, 70, 145, 68, 177, 84, 111, 240, 8, 57, 1,
+    79, 244, 138, 37, 10, 195, 80, 164, 81, 40, 86, 26, 133, 34, 137, 127, 128, 8, 37, 1, 79, 246, 74, 149, 38,
+    201, 82, 164, 217, 47, 240, 8, 57, 1, 79, 244, 138, 141, 138, 137, 72, 168, 216, 168, 148, 138, 141, 138,
+    137, 127, 128, 8, 37, 1, 79, 245, 10, 21, 34, 195, 68, 168, 80, 175, 240, 8, 57, 1, 79, 255, 147, 153, 55,
+    248, 8, 49, 233, 79, 255, 197, 98, 191, 192, 8, 57, 1, 79, 255, 195, 156, 55, 248, 2, 36, 0, 127, 128, 8,
+    49, 233, 79, 244, 74, 141, 18, 163, 68, 168, 209, 42, 52, 74, 141, 254, 8, 57, 1, 79, 244, 42, 133, 18,
+    195, 72, 161, 84, 40, 150, 26, 69, 10, 161, 127, 128, 2, 56, 0, 127, 222, 12, 37, 1, 207, 255, 81, 27, 17,
+    81, 18, 145, 21, 17, 177, 21, 17, 47, 255, 8, 37, 1, 79, 244, 74, 69, 66, 195, 66, 162, 82, 47, 240, 8, 37,
+    1, 79, 246, 74, 149, 38, 201, 82, 164, 217, 47, 240, 8, 49, 233, 79, 246, 42, 141, 34, 137, 98, 168, 210,
+    40, 150, 42, 141, 254, 8, 49, 233, 79, 244, 138, 37, 10, 195, 80, 164, 81, 40, 86, 26, 133, 254, 8, 37, 1,
+    79, 246, 74, 149, 38, 201, 82, 164, 217, 47, 240, 8, 37, 1, 79, 244, 74, 69, 70, 197, 68, 164, 84, 111,
+    240, 8, 57, 1, 79, 245, 10, 21, 34, 195, 68, 168, 80, 169, 22, 26, 37, 66, 133, 127, 128, 8, 37, 1, 79,
+    253, 147, 127, 128, 8, 37, 1, 79, 253, 163, 127, 128, 12, 37, 1, 207, 255, 220, 33, 127, 248, 8, 37, 1, 79,
+    245, 43, 37, 38, 165, 100, 164, 212, 175, 240, 8, 49, 233, 79, 246, 42, 69, 138, 145, 98, 164, 88, 169, 22,
+    42, 69, 254, 8, 37, 1, 79, 244, 42, 133, 18, 195, 72, 161, 84, 47, 240, 8, 57, 1, 79, 245, 43, 37, 38, 165,
+    100, 164, 212, 172, 148, 154, 149, 146, 147, 127, 128, 2, 56, 0, 127, 222, 8, 57, 1, 79, 244, 74, 69, 66,
+    195, 66, 162, 82, 42, 22, 26, 21, 18, 145, 127, 128, 8, 13, 33, 79, 244, 11, 252};
+
+const ILI9486_t3_font_t HostFont_20 = {HostFont_20_index, 0, HostFont_20_data, 1, 0, 32, 126, 0, 0, 16, 5, 6, 2, 5, 6, 23, 14};
+
+static const unsigned char HostFont_32_index[] = {
+    0, 0, 0, 4, 0, 22, 0, 38, 0, 82, 0, 126, 0, 190, 0, 234, 0, 242, 1, 30, 1, 74, 1, 88, 1, 102, 1, 108, 1,
+    121, 1, 127, 1, 171, 1, 215, 1, 232, 2, 20, 2, 64, 2, 108, 2, 152, 2, 196, 2, 240, 3, 28, 3, 42, 3, 49, 3,
+    56, 3, 100, 3, 113, 3, 157, 3, 201, 4, 9, 4, 53, 4, 97, 4, 141, 4, 185, 4, 229, 5, 17, 5, 61, 5, 75, 5, 89,
+    5, 103, 5, 147, 5, 191, 5, 255, 6, 43, 6, 87, 6, 131, 6, 175, 6, 219, 7, 7, 7, 51, 7, 95, 7, 139, 7, 157,
+    7, 171, 7, 185, 7, 229, 8, 17, 8, 61, 8, 105, 8, 121, 8, 165, 8, 173, 8, 205, 8, 249, 9, 25, 9, 69, 9, 101,
+    9, 115, 9, 128, 9, 142, 9, 156, 9, 197, 9, 241, 10, 3, 10, 49, 10, 81, 10, 113, 10, 154, 10, 195, 10, 227,
+    11, 3, 11, 47, 11, 59, 11, 71, 11, 86, 11, 118, 11, 159, 11, 191, 11, 235, 11, 252, 12, 40};
+
+static const unsigned char HostFont_32_data[] = {
+    0, 0, 0, 224, 4, 93, 0, 207, 91, 82, 182, 165, 109, 74, 218, 149, 181, 43, 106, 86, 212, 188, 13, 29, 129,
+    239, 255, 177, 18, 136, 138, 68, 106, 34, 177, 18, 255, 248, 13, 93, 1, 239, 255, 162, 18, 144, 138, 132,
+    44, 33, 161, 10, 136, 74, 66, 42, 16, 176, 134, 132, 42, 33, 41, 8, 168, 66, 194, 26, 16, 168, 132, 164,
+    34, 161, 11, 8, 104, 66, 162, 18, 255, 248, 13, 93, 1, 239, 255, 178, 74, 164, 154, 73, 44, 146, 169, 38,
+    146, 75, 36, 170, 73, 164, 146, 201, 42, 146, 105, 36, 178, 74, 164, 154, 73, 44, 146, 169, 38, 146, 75,
+    36, 170, 73, 164, 146, 255, 248, 20, 93, 2, 207, 255, 255, 68, 68, 75, 17, 17, 84, 68, 70, 145, 17, 20, 68,
+    68, 177, 17, 21, 68, 68, 105, 17, 17, 68, 68, 75, 17, 17, 84, 68, 70, 145, 17, 20, 68, 68, 177, 17, 21, 68,
+    68, 105, 17, 17, 68, 68, 75, 17, 17, 84, 68, 70, 145, 17, 20, 68, 68, 191, 255, 252, 13, 93, 1, 239, 255,
+    164, 34, 136, 74, 16, 172, 33, 168, 66, 144, 138, 33, 40, 66, 176, 134, 161, 10, 66, 40, 132, 161, 10, 194,
+    26, 132, 41, 8, 162, 18, 132, 43, 8, 106, 16, 164, 34, 255, 248, 4, 29, 128, 207, 106, 210, 213, 188, 13,
+    93, 1, 239, 255, 164, 70, 162, 43, 17, 40, 136, 164, 70, 162, 43, 17, 40, 136, 164, 70, 162, 43, 17, 40,
+    136, 164, 70, 162, 43, 17, 40, 136, 164, 70, 162, 43, 17, 40, 136, 164, 70, 255, 248, 13, 93, 1, 239, 255,
+    168, 66, 132, 42, 66, 44, 33, 162, 18, 161, 10, 16, 169, 8, 176, 134, 136, 74, 132, 40, 66, 164, 34, 194,
+    26, 33, 42, 16, 161, 10, 144, 139, 8, 104, 132, 168, 66, 255, 248, 13, 93, 1, 239, 255, 252, 146, 126, 73,
+    51, 36, 151, 255, 192, 13, 93, 1, 239, 255, 254, 34, 127, 17, 51, 136, 151, 255, 192, 4, 17, 216, 207, 141,
+    120, 13, 21, 57, 239, 255, 169, 38, 201, 42, 73, 47, 255, 128, 4, 17, 0, 207, 74, 222, 13, 93, 1, 239, 255,
+    161, 10, 161, 10, 33, 44, 33, 164, 34, 132, 42, 132, 40, 132, 176, 134, 144, 138, 16, 170, 16, 162, 18,
+    194, 26, 66, 40, 66, 168, 66, 136, 75, 8, 105, 8, 161, 10, 255, 248, 13, 93, 1, 239, 255, 169, 38, 201, 42,
+    73, 42, 73, 178, 74, 146, 74, 146, 108, 146, 164, 146, 164, 155, 36, 169, 36, 169, 38, 201, 42, 73, 42, 73,
+    178, 74, 146, 74, 146, 108, 146, 164, 146, 255, 248, 4, 93, 0, 207, 91, 98, 86, 216, 149, 182, 37, 109,
+    137, 91, 98, 86, 240, 13, 93, 1, 239, 255, 162, 18, 144, 138, 132, 44, 33, 161, 10, 136, 74, 66, 42, 16,
+    176, 134, 132, 42, 33, 41, 8, 168, 66, 194, 26, 16, 168, 132, 164, 34, 161, 11, 8, 104, 66, 162, 18, 255,
+    248, 13, 93, 1, 239, 255, 178, 74, 164, 154, 73, 44, 146, 169, 38, 146, 75, 36, 170, 73, 164, 146, 201, 42,
+    146, 105, 36, 178, 74, 164, 154, 73, 44, 146, 169, 38, 146, 75, 36, 170, 73, 164, 146, 255, 248, 13, 93, 1,
+    239, 255, 177, 18, 162, 42, 68, 104, 136, 177, 18, 162, 42, 68, 104, 136, 177, 18, 162, 42, 68, 104, 136,
+    177, 18, 162, 42, 68, 104, 136, 177, 18, 162, 42, 68, 104, 136, 177, 18, 255, 248, 13, 93, 1, 239, 255,
+    164, 34, 136, 74, 16, 172, 33, 168, 66, 144, 138, 33, 40, 66, 176, 134, 161, 10, 66, 40, 132, 161, 10, 194,
+    26, 132, 41, 8, 162, 18, 132, 43, 8, 106, 16, 164, 34, 255, 248, 13, 93, 1, 239, 255, 178, 74, 164, 154,
+    73, 44, 146, 169, 38, 146, 75, 36, 170, 73, 164, 146, 201, 42, 146, 105, 36, 178, 74, 164, 154, 73, 44,
+    146, 169, 38, 146, 75, 36, 170, 73, 164, 146, 255, 248, 13, 93, 1, 239, 255, 162, 34, 145, 26, 136, 172,
+    68, 162, 34, 145, 26, 136, 172, 68, 162, 34, 145, 26, 136, 172, 68, 162, 34, 145, 26, 136, 172, 68, 162,
+    34, 145, 26, 136, 172, 68, 162, 34, 255, 248, 13, 93, 1, 239, 255, 168, 66, 132, 42, 66, 44, 33, 162, 18,
+    161, 10, 16, 169, 8, 176, 134, 136, 74, 132, 40, 66, 164, 34, 194, 26, 33, 42, 16, 161, 10, 144, 139, 8,
+    104, 132, 168, 66, 255, 248, 13, 93, 1, 239, 255, 252, 146, 126, 73, 51, 36, 151, 255, 192, 4, 65, 0, 207,
+    251, 187, 120, 4, 65, 216, 207, 253, 189, 120, 13, 93, 1, 239, 255, 169, 38, 201, 42, 73, 42, 73, 178, 74,
+    146, 74, 146, 108, 146, 164, 146, 164, 155, 36, 169, 36, 169, 38, 201, 42, 73, 42, 73, 178, 74, 146, 74,
+    146, 108, 146, 164, 146, 255, 248, 13, 21, 57, 239, 255, 177, 18, 145, 27, 17, 47, 255, 128, 13, 93, 1,
+    239, 255, 161, 10, 161, 10, 33, 44, 33, 164, 34, 132, 42, 132, 40, 132, 176, 134, 144, 138, 16, 170, 16,
+    162, 18, 194, 26, 66, 40, 66, 168, 66, 136, 75, 8, 105, 8, 161, 10, 255, 248, 13, 93, 1, 239, 255, 169, 38,
+    201, 42, 73, 42, 73, 178, 74, 146, 74, 146, 108, 146, 164, 146, 164, 155, 36, 169, 36, 169, 38, 201, 42,
+    73, 42, 73, 178, 74, 146, 74, 146, 108, 146, 164, 146, 255, 248, 20, 93, 2, 207, 255, 255, 72, 136, 138,
+    136, 136, 216, 136, 138, 136, 136, 148, 136, 136, 168, 136, 141, 136, 136, 168, 136, 137, 72, 136, 138,
+    136, 136, 216, 136, 138, 136, 136, 148, 136, 136, 168, 136, 141, 136, 136, 168, 136, 137, 72, 136, 138,
+    136, 136, 216, 136, 138, 136, 136, 148, 136, 136, 191, 255, 252, 13, 93, 1, 239, 255, 162, 18, 144, 138,
+    132, 44, 33, 161, 10, 136, 74, 66, 42, 16, 176, 134, 132, 42, 33, 41, 8, 168, 66, 194, 26, 16, 168, 132,
+    164, 34, 161, 11, 8, 104, 66, 162, 18, 255, 248, 13, 93, 1, 239, 255, 178, 74, 164, 154, 73, 44, 146, 169,
+    38, 146, 75, 36, 170, 73, 164, 146, 201, 42, 146, 105, 36, 178, 74, 164, 154, 73, 44, 146, 169, 38, 146,
+    75, 36, 170, 73, 164, 146, 255, 248, 13, 93, 1, 239, 255, 168, 138, 145, 26, 34, 44, 68, 168, 138, 145, 26,
+    34, 44, 68, 168, 138, 145, 26, 34, 44, 68, 168, 138, 145, 26, 34, 44, 68, 168, 138, 145, 26, 34, 44, 68,
+    168, 138, 255, 248, 13, 93, 1, 239, 255, 164, 34, 136, 74, 16, 172, 33, 168, 66, 144, 138, 33, 40, 66, 176,
+    134, 161, 10, 66, 40, 132, 161, 10, 194, 26, 132, 41, 8, 162, 18, 132, 43, 8, 106, 16, 164, 34, 255, 248,
+    13, 93, 1, 239, 255, 178, 74, 164, 154, 73, 44, 146, 169, 38, 146, 75, 36, 170, 73, 164, 146, 201, 42, 146,
+    105, 36, 178, 74, 164, 154, 73, 44, 146, 169, 38, 146, 75, 36, 170, 73, 164, 146, 255, 248, 13, 93, 1, 239,
+    255, 177, 18, 136, 138, 68, 106, 34, 177, 18, 136, 138, 68, 106, 34, 177, 18, 136, 138, 68, 106, 34, 177,
+    18, 136, 138, 68, 106, 34, 177, 18, 136, 138, 68, 106, 34, 177, 18, 255, 248, 13, 93, 1, 239, 255, 168, 66,
+    132, 42, 66, 44, 33, 162, 18, 161, 10, 16, 169, 8, 176, 134, 136, 74, 132, 40, 66, 164, 34, 194, 26, 33,
+    42, 16, 161, 10, 144, 139, 8, 104, 132, 168, 66, 255, 248, 13, 93, 1, 239, 255, 252, 146, 126, 73, 51, 36,
+    151, 255, 192, 13, 93, 1, 239, 255, 252, 136, 254, 68, 115, 34, 55, 255, 192, 13, 93, 1, 239, 255, 254, 16,
+    255, 8, 115, 132, 55, 255, 192, 13, 93, 1, 239, 255, 169, 38, 201, 42, 73, 42, 73, 178, 74, 146, 74, 146,
+    108, 146, 164, 146, 164, 155, 36, 169, 36, 169, 38, 201, 42, 73, 42, 73, 178, 74, 146, 74, 146, 108, 146,
+    164, 146, 255, 248, 13, 93, 1, 239, 255, 168, 138, 136, 138, 136, 168, 136, 168, 138, 136, 138, 136, 168,
+    136, 168, 138, 136, 138, 136, 168, 136, 168, 138, 136, 138, 136, 168, 136, 168, 138, 136, 138, 136, 168,
+    136, 168, 138, 255, 248, 20, 93, 2, 207, 255, 255, 66, 16, 138, 132, 33, 81, 8, 66, 194, 16, 148, 132, 33,
+    161, 8, 69, 66, 16, 168, 132, 33, 97, 8, 74, 66, 16, 208, 132, 34, 161, 8, 84, 66, 16, 176, 132, 37, 33, 8,
+    104, 66, 17, 80, 132, 42, 33, 8, 88, 66, 18, 144, 132, 52, 33, 8, 191, 255, 252, 13, 93, 1, 239, 255, 169,
+    38, 201, 42, 73, 42, 73, 178, 74, 146, 74, 146, 108, 146, 164, 146, 164, 155, 36, 169, 36, 169, 38, 201,
+    42, 73, 42, 73, 178, 74, 146, 74, 146, 108, 146, 164, 146, 255, 248, 13, 93, 1, 239, 255, 162, 34, 145, 26,
+    136, 172, 68, 162, 34, 145, 26, 136, 172, 68, 162, 34, 145, 26, 136, 172, 68, 162, 34, 145, 26, 136, 172,
+    68, 162, 34, 145, 26, 136, 172, 68, 162, 34, 255, 248, 13, 93, 1, 239, 255, 162, 18, 144, 138, 132, 44, 33,
+    161, 10, 136, 74, 66, 42, 16, 176, 134, 132, 42, 33, 41, 8, 168, 66, 194, 26, 16, 168, 132, 164, 34, 161,
+    11, 8, 104, 66, 162, 18, 255, 248, 13, 93, 1, 239, 255, 178, 74, 164, 154, 73, 44, 146, 169, 38, 146, 75,
+    36, 170, 73, 164, 146, 201, 42, 146, 105, 36, 178, 74, 164, 154, 73, 44, 146, 169, 38, 146, 75, 36, 170,
+    73, 164, 146, 255, 248, 13, 93, 1, 239, 255, 164, 70, 136, 139, 17, 42, 34, 164, 70, 136, 139, 17, 42, 34,
+    164, 70, 136, 139, 17, 42, 34, 164, 70, 136, 139, 17, 42, 34, 164, 70, 136, 139, 17, 42, 34, 164, 70, 255,
+    248, 13, 93, 1, 239, 255, 164, 34, 136, 74, 16, 172, 33, 168, 66, 144, 138, 33, 40, 66, 176, 134, 161, 10,
+    66, 40, 132, 161, 10, 194, 26, 132, 41, 8, 162, 18, 132, 43, 8, 106, 16, 164, 34, 255, 248, 13, 93, 1, 239,
+    255, 178, 74, 164, 154, 73, 44, 146, 169, 38, 146, 75, 36, 170, 73, 164, 146, 201, 42, 146, 105, 36, 178,
+    74, 164, 154, 73, 44, 146, 169, 38, 146, 75, 36, 170, 73, 164, 146, 255, 248, 13, 93, 1, 239, 255, 168,
+    138, 196, 74, 34, 41, 17, 168, 138, 196, 74, 34, 41, 17, 168, 138, 196, 74, 34, 41, 17, 168, 138, 196, 74,
+    34, 41, 17, 168, 138, 196, 74, 34, 41, 17, 168, 138, 255, 248, 13, 93, 1, 239, 255, 168, 66, 132, 42, 66,
+    44, 33, 162, 18, 161, 10, 16, 169, 8, 176, 134, 136, 74, 132, 40, 66, 164, 34, 194, 26, 33, 42, 16, 161,
+    10, 144, 139, 8, 104, 132, 168, 66, 255, 248, 20, 93, 2, 207, 255, 255, 249, 36, 147, 249, 36, 147, 153,
+    36, 147, 127, 255, 248, 13, 93, 1, 239, 255, 252, 68, 126, 34, 51, 17, 23, 255, 192, 13, 93, 1, 239, 255,
+    254, 16, 255, 8, 115, 132, 55, 255, 192, 13, 93, 1, 239, 255, 169, 38, 201, 42, 73, 42, 73, 178, 74, 146,
+    74, 146, 108, 146, 164, 146, 164, 155, 36, 169, 36, 169, 38, 201, 42, 73, 42, 73, 178, 74, 146, 74, 146,
+    108, 146, 164, 146, 255, 248, 13, 93, 1, 239, 255, 164, 70, 196, 74, 68, 108, 68, 164, 70, 196, 74, 68,
+    108, 68, 164, 70, 196, 74, 68, 108, 68, 164, 70, 196, 74, 68, 108, 68, 164, 70, 196, 74, 68, 108, 68, 164,
+    70, 255, 248, 13, 93, 1, 239, 255, 161, 10, 161, 10, 33, 44, 33, 164, 34, 132, 42, 132, 40, 132, 176, 134,
+    144, 138, 16, 170, 16, 162, 18, 194, 26, 66, 40, 66, 168, 66, 136, 75, 8, 105, 8, 161, 10, 255, 248, 13,
+    93, 1, 239, 255, 169, 38, 201, 42, 73, 42, 73, 178, 74, 146, 74, 146, 108, 146, 164, 146, 164, 155, 36,
+    169, 36, 169, 38, 201, 42, 73, 42, 73, 178, 74, 146, 74, 146, 108, 146, 164, 146, 255, 248, 13, 29, 129,
+    239, 255, 177, 18, 136, 138, 68, 106, 34, 177, 18, 255, 248, 13, 93, 1, 239, 255, 162, 18, 144, 138, 132,
+    44, 33, 161, 10, 136, 74, 66, 42, 16, 176, 134, 132, 42, 33, 41, 8, 168, 66, 194, 26, 16, 168, 132, 164,
+    34, 161, 11, 8, 104, 66, 162, 18, 255, 248, 4, 29, 128, 207, 106, 210, 213, 188, 13, 65, 1, 239, 255, 162,
+    34, 196, 74, 136, 169, 17, 162, 34, 196, 74, 136, 169, 17, 162, 34, 196, 74, 136, 169, 17, 162, 34, 196,
+    75, 255, 224, 13, 93, 1, 239, 255, 164, 34, 136, 74, 16, 172, 33, 168, 66, 144, 138, 33, 40, 66, 176, 134,
+    161, 10, 66, 40, 132, 161, 10, 194, 26, 132, 41, 8, 162, 18, 132, 43, 8, 106, 16, 164, 34, 255, 248, 13,
+    65, 1, 239, 255, 178, 74, 164, 154, 73, 44, 146, 169, 38, 146, 75, 36, 170, 73, 164, 146, 201, 42, 146,
+    105, 36, 178, 74, 164, 155, 255, 224, 13, 93, 1, 239, 255, 164, 70, 162, 43, 17, 40, 136, 164, 70, 162, 43,
+    17, 40, 136, 164, 70, 162, 43, 17, 40, 136, 164, 70, 162, 43, 17, 40, 136, 164, 70, 162, 43, 17, 40, 136,
+    164, 70, 255, 248, 13, 65, 1, 239, 255, 168, 66, 132, 42, 66, 44, 33, 162, 18, 161, 10, 16, 169, 8, 176,
+    134, 136, 74, 132, 40, 66, 164, 34, 194, 27, 255, 224, 13, 93, 1, 239, 255, 252, 146, 126, 73, 51, 36, 151,
+    255, 192, 13, 85, 217, 239, 255, 254, 34, 127, 17, 44, 68, 191, 254, 13, 93, 1, 239, 255, 254, 16, 255, 8,
+    115, 132, 55, 255, 192, 4, 65, 0, 207, 91, 82, 182, 165, 109, 74, 218, 149, 181, 224, 13, 85, 217, 239,
+    255, 162, 34, 162, 42, 34, 42, 34, 162, 34, 162, 42, 34, 42, 34, 162, 34, 162, 42, 34, 42, 34, 162, 34,
+    162, 42, 34, 42, 34, 162, 34, 162, 42, 34, 47, 255, 128, 13, 93, 1, 239, 255, 161, 10, 161, 10, 33, 44, 33,
+    164, 34, 132, 42, 132, 40, 132, 176, 134, 144, 138, 16, 170, 16, 162, 18, 194, 26, 66, 40, 66, 168, 66,
+    136, 75, 8, 105, 8, 161, 10, 255, 248, 4, 93, 0, 207, 91, 82, 182, 165, 109, 74, 218, 149, 181, 43, 106,
+    86, 212, 188, 20, 65, 2, 207, 255, 255, 81, 17, 27, 17, 17, 81, 17, 18, 145, 17, 21, 17, 17, 177, 17, 21,
+    17, 17, 41, 17, 17, 81, 17, 27, 17, 17, 81, 17, 18, 145, 17, 21, 17, 17, 177, 17, 21, 255, 255, 224, 13,
+    65, 1, 239, 255, 162, 18, 144, 138, 132, 44, 33, 161, 10, 136, 74, 66, 42, 16, 176, 134, 132, 42, 33, 41,
+    8, 168, 66, 194, 27, 255, 224, 13, 65, 1, 239, 255, 178, 74, 164, 154, 73, 44, 146, 169, 38, 146, 75, 36,
+    170, 73, 164, 146, 201, 42, 146, 105, 36, 178, 74, 164, 155, 255, 224, 13, 85, 217, 239, 255, 177, 18, 162,
+    42, 68, 104, 136, 177, 18, 162, 42, 68, 104, 136, 177, 18, 162, 42, 68, 104, 136, 177, 18, 162, 42, 68,
+    104, 136, 177, 18, 162, 42, 68, 111, 255, 128, 13, 85, 217, 239, 255, 164, 34, 136, 74, 16, 172, 33, 168,
+    66, 144, 138, 33, 40, 66, 176, 134, 161, 10, 66, 40, 132, 161, 10, 194, 26, 132, 41, 8, 162, 18, 132, 43,
+    8, 111, 255, 128, 13, 65, 1, 239, 255, 178, 74, 164, 154, 73, 44, 146, 169, 38, 146, 75, 36, 170, 73, 164,
+    146, 201, 42, 146, 105, 36, 178, 74, 164, 155, 255, 224, 13, 65, 1, 239, 255, 162, 34, 145, 26, 136, 172,
+    68, 162, 34, 145, 26, 136, 172, 68, 162, 34, 145, 26, 136, 172, 68, 162, 34, 145, 27, 255, 224, 13, 93, 1,
+    239, 255, 168, 66, 132, 42, 66, 44, 33, 162, 18, 161, 10, 16, 169, 8, 176, 134, 136, 74, 132, 40, 66, 164,
+    34, 194, 26, 33, 42, 16, 161, 10, 144, 139, 8, 104, 132, 168, 66, 255, 248, 13, 65, 1, 239, 255, 252, 146,
+    110, 73, 47, 255, 128, 13, 65, 1, 239, 255, 253, 17, 110, 136, 175, 255, 128, 20, 65, 2, 207, 255, 255,
+    252, 33, 9, 188, 33, 9, 127, 255, 248, 13, 65, 1, 239, 255, 169, 38, 201, 42, 73, 42, 73, 178, 74, 146, 74,
+    146, 108, 146, 164, 146, 164, 155, 36, 169, 36, 169, 38, 201, 43, 255, 224, 13, 85, 217, 239, 255, 177, 18,
+    145, 27, 17, 41, 17, 177, 18, 145, 27, 17, 41, 17, 177, 18, 145, 27, 17, 41, 17, 177, 18, 145, 27, 17, 41,
+    17, 177, 18, 145, 27, 17, 47, 255, 128, 13, 65, 1, 239, 255, 161, 10, 161, 10, 33, 44, 33, 164, 34, 132,
+    42, 132, 40, 132, 176, 134, 144, 138, 16, 170, 16, 162, 18, 194, 27, 255, 224, 13, 93, 1, 239, 255, 169,
+    38, 201, 42, 73, 42, 73, 178, 74, 146, 74, 146, 108, 146, 164, 146, 164, 155, 36, 169, 36, 169, 38, 201,
+    42, 73, 42, 73, 178, 74, 146, 74, 146, 108, 146, 164, 146, 255, 248, 4, 93, 0, 207, 74, 219, 18, 182, 196,
+    173, 177, 43, 108, 74, 219, 18, 240, 13, 93, 1, 239, 255, 162, 18, 144, 138, 132, 44, 33, 161, 10, 136, 74,
+    66, 42, 16, 176, 134, 132, 42, 33, 41, 8, 168, 66, 194, 26, 16, 168, 132, 164, 34, 161, 11, 8, 104, 66,
+    162, 18, 255, 248, 13, 21, 57, 239, 255, 178, 74, 164, 154, 73, 47, 255, 128};
+
+const ILI9486_t3_font_t HostFont_32 = {HostFont_32_index, 0, HostFont_32_data, 1, 0, 32, 126, 0, 0, 16, 5, 6, 2, 5, 6, 36, 23};
+
+#endif
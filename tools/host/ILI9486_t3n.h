@@ -0,0 +1,779 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Host backend: ILI9486_t3n in memory, for builds on Linux (benchmarks and tests in tools/).
+ * The drawing functions work like the ones of the ILI9341_t3n family (clip rect, origin, framebuffer, the line,
+ * circle and triangle algorithms and drawFontChar), so frames drawn here are the frames of the display.
+ * panel holds what the display shows. Without framebuffer every call is sent to it, with framebuffer
+ * updateScreen() sends the whole frame, updateScreenAsync() does it like a DMA in the background.
+ *
+ * SPI is not simulated, but its time can be: with spiMHz set, sending waits for the time the bytes would need
+ * (2 per pixel and 11 per address window), a DMA update is complete after that time.
+ */
+
+#ifndef _ILI9486_t3NH_
+#define _ILI9486_t3NH_
+
+#include "Arduino.h"
+
+#define ILI9486_TFTWIDTH 320
+#define ILI9486_TFTHEIGHT 480
+
+typedef struct
+{
+    const unsigned char *index;
+    const unsigned char *unicode;
+    const unsigned char *data;
+    unsigned char version;
+    unsigned char reserved;
+    unsigned char index1_first;
+    unsigned char index1_last;
+    unsigned char index2_first;
+    unsigned char index2_last;
+    unsigned char bits_index;
+    unsigned char bits_width;
+    unsigned char bits_height;
+    unsigned char bits_xoffset;
+    unsigned char bits_yoffset;
+    unsigned char bits_delta;
+    unsigned char line_space;
+    unsigned char cap_height;
+} ILI9486_t3_font_t;
+
+class ILI9486_t3n : public Print
+{
+public:
+    uint16_t panel[ILI9486_TFTWIDTH * ILI9486_TFTHEIGHT];
+    float spiMHz = 0;        // > 0: sending takes the time of SPI at this clock
+    uint32_t windows = 0;    // address windows sent
+    uint32_t pixelsSent = 0; // pixels sent
+
+    ILI9486_t3n(uint8_t cs, uint8_t dc, uint8_t rst = 255, uint8_t mosi = 11, uint8_t sclk = 13, uint8_t miso = 12)
+    {
+        memset(panel, 0, sizeof(panel));
+    }
+
+    ~ILI9486_t3n()
+    {
+        free(_allocated);
+    }
+
+    void begin()
+    {
+    }
+
+    void setRotation(uint8_t m)
+    {
+        _rotation = m & 3;
+        _width = _rotation & 1 ? ILI9486_TFTHEIGHT : ILI9486_TFTWIDTH;
+        _height = _rotation & 1 ? ILI9486_TFTWIDTH : ILI9486_TFTHEIGHT;
+        setClipRect();
+        setOrigin();
+        cursor_x = 0;
+        cursor_y = 0;
+    }
+
+    uint8_t getRotation()
+    {
+        return _rotation;
+    }
+
+    int16_t width()
+    {
+        return _width;
+    }
+
+    int16_t height()
+    {
+        return _height;
+    }
+
+    // ---------------------------------------------------------------- framebuffer
+
+    void setFrameBuffer(uint16_t *frameBuffer)
+    {
+        _pfbtft = frameBuffer;
+    }
+
+    uint8_t useFrameBuffer(boolean enable)
+    {
+        if (enable && _pfbtft == NULL)
+        {
+            _allocated = (uint16_t *)calloc(ILI9486_TFTWIDTH * ILI9486_TFTHEIGHT, sizeof(uint16_t));
+            _pfbtft = _allocated;
+        }
+        _use_fbtft = enable && _pfbtft != NULL;
+        return _use_fbtft;
+    }
+
+    uint16_t *getFrameBuffer()
+    {
+        return _pfbtft;
+    }
+
+    void freeFrameBuffer()
+    {
+        if (_pfbtft == _allocated)
+            _pfbtft = NULL;
+        free(_allocated);
+        _allocated = NULL;
+        _use_fbtft = false;
+    }
+
+    void updateScreen()
+    {
+        if (!_use_fbtft)
+            return;
+        waitUpdateAsyncComplete();
+        memcpy(panel, _pfbtft, (uint32_t)_width * _height * 2);
+        sent(1, (uint32_t)_width * _height);
+        wait();
+    }
+
+    // the frame is on the display when the time of the transfer is over
+    bool updateScreenAsync(bool updateContinuously = false)
+    {
+        if (!_use_fbtft)
+            return false;
+        waitUpdateAsyncComplete();
+        memcpy(panel, _pfbtft, (uint32_t)_width * _height * 2);
+        sent(1, (uint32_t)_width * _height);
+        _asyncEnd = micros() + (uint32_t)(_wire * 1e6);
+        _wire = 0;
+        _asyncActive = true;
+        return true;
+    }
+
+    bool asyncUpdateActive()
+    {
+        if (_asyncActive && (int32_t)(micros() - _asyncEnd) >= 0)
+            _asyncActive = false;
+        return _asyncActive;
+    }
+
+    void waitUpdateAsyncComplete()
+    {
+        if (!_asyncActive)
+            return;
+        int32_t left = (int32_t)(_asyncEnd - micros());
+        if (left > 0)
+            delayMicroseconds(left);
+        _asyncActive = false;
+    }
+
+    // ---------------------------------------------------------------- clip and origin
+
+    void setClipRect(int16_t x, int16_t y, int16_t w, int16_t h)
+    {
+        _clipx1 = x;
+        _clipy1 = y;
+        _clipx2 = x + w;
+        _clipy2 = y + h;
+        updateDisplayClip();
+    }
+
+    void setClipRect()
+    {
+        _clipx1 = 0;
+        _clipy1 = 0;
+        _clipx2 = _width;
+        _clipy2 = _height;
+        updateDisplayClip();
+    }
+
+    void setOrigin(int16_t x = 0, int16_t y = 0)
+    {
+        _originx = x;
+        _originy = y;
+        updateDisplayClip();
+    }
+
+    void getOrigin(int16_t *x, int16_t *y)
+    {
+        *x = _originx;
+        *y = _originy;
+    }
+
+    // ---------------------------------------------------------------- shapes
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color)
+    {
+        pixel(x + _originx, y + _originy, color);
+        sent(1, 1);
+    }
+
+    void fillScreen(uint16_t color)
+    {
+        fillRect(0, 0, _width, _height, color);
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+    {
+        x += _originx;
+        y += _originy;
+        if (x >= _displayclipx2 || y >= _displayclipy2)
+            return;
+        if (x < _displayclipx1)
+        {
+            w -= _displayclipx1 - x;
+            x = _displayclipx1;
+        }
+        if (y < _displayclipy1)
+        {
+            h -= _displayclipy1 - y;
+            y = _displayclipy1;
+        }
+        if (x + w - 1 >= _displayclipx2)
+            w = _displayclipx2 - x;
+        if (y + h - 1 >= _displayclipy2)
+            h = _displayclipy2 - y;
+        if (w < 1 || h < 1)
+            return;
+
+        uint16_t *target = frame();
+        for (int16_t row = y; row < y + h; row++)
+        {
+            uint16_t *p = target + (uint32_t)row * _width + x;
+            for (int16_t i = 0; i < w; i++)
+                p[i] = color;
+        }
+        sent(1, (uint32_t)w * h);
+    }
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+    {
+        fillRect(x, y, w, 1, color);
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+    {
+        fillRect(x, y, 1, h, color);
+    }
+
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+    {
+        drawFastHLine(x, y, w, color);
+        drawFastHLine(x, y + h - 1, w, color);
+        drawFastVLine(x, y, h, color);
+        drawFastVLine(x + w - 1, y, h, color);
+    }
+
+    // runs of the line as fast lines, like ILI9341_t3n
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+    {
+        if (y0 == y1)
+        {
+            if (x1 > x0)
+                drawFastHLine(x0, y0, x1 - x0 + 1, color);
+            else if (x1 < x0)
+                drawFastHLine(x1, y0, x0 - x1 + 1, color);
+            else
+                drawPixel(x0, y0, color);
+            return;
+        }
+        if (x0 == x1)
+        {
+            if (y1 > y0)
+                drawFastVLine(x0, y0, y1 - y0 + 1, color);
+            else
+                drawFastVLine(x0, y1, y0 - y1 + 1, color);
+            return;
+        }
+
+        bool steep = abs(y1 - y0) > abs(x1 - x0);
+        if (steep)
+        {
+            swap(x0, y0);
+            swap(x1, y1);
+        }
+        if (x0 > x1)
+        {
+            swap(x0, x1);
+            swap(y0, y1);
+        }
+
+        int16_t dx = x1 - x0;
+        int16_t dy = abs(y1 - y0);
+        int16_t err = dx / 2;
+        int16_t ystep = y0 < y1 ? 1 : -1;
+        int16_t xbegin = x0;
+
+        for (; x0 <= x1; x0++)
+        {
+            err -= dy;
+            if (err < 0)
+            {
+                int16_t length = x0 - xbegin + 1;
+                if (steep)
+                    drawFastVLine(y0, xbegin, length, color);
+                else
+                    drawFastHLine(xbegin, y0, length, color);
+                xbegin = x0 + 1;
+                y0 += ystep;
+                err += dx;
+            }
+        }
+        if (x0 > xbegin + 1)
+        {
+            if (steep)
+                drawFastVLine(y0, xbegin, x0 - xbegin, color);
+            else
+                drawFastHLine(xbegin, y0, x0 - xbegin, color);
+        }
+    }
+
+    void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+    {
+        drawPixel(x0, y0 + r, color);
+        drawPixel(x0, y0 - r, color);
+        drawPixel(x0 + r, y0, color);
+        drawPixel(x0 - r, y0, color);
+        drawCircleHelper(x0, y0, r, 0x0F, color);
+    }
+
+    void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, uint16_t color)
+    {
+        int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+        while (x < y)
+        {
+            if (f >= 0)
+            {
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x;
+            if (cornername & 0x4)
+            {
+                drawPixel(x0 + x, y0 + y, color);
+                drawPixel(x0 + y, y0 + x, color);
+            }
+            if (cornername & 0x2)
+            {
+                drawPixel(x0 + x, y0 - y, color);
+                drawPixel(x0 + y, y0 - x, color);
+            }
+            if (cornername & 0x8)
+            {
+                drawPixel(x0 - y, y0 + x, color);
+                drawPixel(x0 - x, y0 + y, color);
+            }
+            if (cornername & 0x1)
+            {
+                drawPixel(x0 - y, y0 - x, color);
+                drawPixel(x0 - x, y0 - y, color);
+            }
+        }
+    }
+
+    void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+    {
+        drawFastVLine(x0, y0 - r, 2 * r + 1, color);
+        fillCircleHelper(x0, y0, r, 3, 0, color);
+    }
+
+    void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, int16_t delta, uint16_t color)
+    {
+        int16_t f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+        while (x < y)
+        {
+            if (f >= 0)
+            {
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x;
+            if (cornername & 0x1)
+            {
+                drawFastVLine(x0 + x, y0 - y, 2 * y + 1 + delta, color);
+                drawFastVLine(x0 + y, y0 - x, 2 * x + 1 + delta, color);
+            }
+            if (cornername & 0x2)
+            {
+                drawFastVLine(x0 - x, y0 - y, 2 * y + 1 + delta, color);
+                drawFastVLine(x0 - y, y0 - x, 2 * x + 1 + delta, color);
+            }
+        }
+    }
+
+    void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
+    {
+        drawFastHLine(x + r, y, w - 2 * r, color);
+        drawFastHLine(x + r, y + h - 1, w - 2 * r, color);
+        drawFastVLine(x, y + r, h - 2 * r, color);
+        drawFastVLine(x + w - 1, y + r, h - 2 * r, color);
+        drawCircleHelper(x + r, y + r, r, 1, color);
+        drawCircleHelper(x + w - r - 1, y + r, r, 2, color);
+        drawCircleHelper(x + w - r - 1, y + h - r - 1, r, 4, color);
+        drawCircleHelper(x + r, y + h - r - 1, r, 8, color);
+    }
+
+    void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
+    {
+        fillRect(x + r, y, w - 2 * r, h, color);
+        fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
+        fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, color);
+    }
+
+    void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color)
+    {
+        if (y0 > y1)
+        {
+            swap(y0, y1);
+            swap(x0, x1);
+        }
+        if (y1 > y2)
+        {
+            swap(y2, y1);
+            swap(x2, x1);
+        }
+        if (y0 > y1)
+        {
+            swap(y0, y1);
+            swap(x0, x1);
+        }
+
+        if (y0 == y2)
+        {
+            int16_t a = x0, b = x0;
+            if (x1 < a)
+                a = x1;
+            else if (x1 > b)
+                b = x1;
+            if (x2 < a)
+                a = x2;
+            else if (x2 > b)
+                b = x2;
+            drawFastHLine(a, y0, b - a + 1, color);
+            return;
+        }
+
+        int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0, dx12 = x2 - x1, dy12 = y2 - y1;
+        int32_t sa = 0, sb = 0;
+        int16_t y = y0;
+        int16_t last = y1 == y2 ? y1 : y1 - 1;
+
+        for (; y <= last; y++)
+        {
+            int16_t a = x0 + sa / dy01;
+            int16_t b = x0 + sb / dy02;
+            sa += dx01;
+            sb += dx02;
+            if (a > b)
+                swap(a, b);
+            drawFastHLine(a, y, b - a + 1, color);
+        }
+
+        sa = (int32_t)dx12 * (y - y1);
+        sb = (int32_t)dx02 * (y - y0);
+        for (; y <= y2; y++)
+        {
+            int16_t a = x1 + sa / dy12;
+            int16_t b = x0 + sb / dy02;
+            sa += dx12;
+            sb += dx02;
+            if (a > b)
+                swap(a, b);
+            drawFastHLine(a, y, b - a + 1, color);
+        }
+    }
+
+    // ---------------------------------------------------------------- pixels
+
+    void writeRect(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pcolors)
+    {
+        x += _originx;
+        y += _originy;
+        uint32_t visible = 0;
+        uint16_t *target = frame();
+        for (int16_t row = 0; row < h; row++)
+        {
+            int16_t py = y + row;
+            if (py < _displayclipy1 || py >= _displayclipy2)
+                continue;
+            for (int16_t col = 0; col < w; col++)
+            {
+                int16_t px = x + col;
+                if (px < _displayclipx1 || px >= _displayclipx2)
+                    continue;
+                target[(uint32_t)py * _width + px] = pcolors[(uint32_t)row * w + col];
+                visible++;
+            }
+        }
+        if (visible > 0)
+            sent(1, visible);
+    }
+
+    void readRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *pcolors)
+    {
+        uint16_t *source = frame();
+        for (int16_t row = 0; row < h; row++)
+            for (int16_t col = 0; col < w; col++)
+                *pcolors++ = source[(uint32_t)(y + row) * _width + x + col];
+    }
+
+    // ---------------------------------------------------------------- text
+
+    void setCursor(int16_t x, int16_t y)
+    {
+        cursor_x = x;
+        cursor_y = y;
+    }
+
+    void getCursor(int16_t *x, int16_t *y)
+    {
+        *x = cursor_x;
+        *y = cursor_y;
+    }
+
+    void setTextColor(uint16_t c)
+    {
+        textcolor = textbgcolor = c;
+    }
+
+    void setTextColor(uint16_t c, uint16_t bg)
+    {
+        textcolor = c;
+        textbgcolor = bg;
+    }
+
+    void setTextWrap(boolean w)
+    {
+        wrap = w;
+    }
+
+    void setFont(const ILI9486_t3_font_t &f)
+    {
+        font = &f;
+    }
+
+    // like ILI9341_t3n, write(c) is write(&c, 1)
+    size_t write(uint8_t c) override
+    {
+        return write(&c, 1);
+    }
+
+    size_t write(const uint8_t *buffer, size_t size) override
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            if (font == NULL)
+                continue;
+            if (buffer[i] == '\n')
+            {
+                cursor_y += font->line_space;
+                cursor_x = 0;
+            }
+            else
+                drawFontChar(buffer[i]);
+        }
+        return size;
+    }
+
+    using Print::write;
+
+    uint16_t strPixelLen(const char *str, uint16_t cb = 0xFFFF)
+    {
+        if (str == NULL || font == NULL)
+            return 0;
+
+        uint16_t length = 0, longest = 0;
+        for (; *str && cb > 0; str++, cb--)
+        {
+            if (*str == '\n')
+            {
+                longest = length > longest ? length : longest;
+                length = 0;
+                continue;
+            }
+
+            uint32_t bitoffset, width, height, delta;
+            int32_t xoffset, yoffset;
+            if (glyph((uint8_t)*str, bitoffset, width, height, xoffset, yoffset, delta) != NULL)
+                length += delta;
+        }
+        return length > longest ? length : longest;
+    }
+
+protected:
+    int16_t _width = ILI9486_TFTWIDTH;
+    int16_t _height = ILI9486_TFTHEIGHT;
+    uint8_t _rotation = 0;
+    int16_t _originx = 0, _originy = 0;
+    int16_t _clipx1 = 0, _clipy1 = 0, _clipx2 = ILI9486_TFTWIDTH, _clipy2 = ILI9486_TFTHEIGHT;
+    int16_t _displayclipx1 = 0, _displayclipy1 = 0, _displayclipx2 = ILI9486_TFTWIDTH, _displayclipy2 = ILI9486_TFTHEIGHT;
+    int16_t cursor_x = 0, cursor_y = 0;
+    uint16_t textcolor = 0xFFFF, textbgcolor = 0xFFFF;
+    boolean wrap = true;
+    const ILI9486_t3_font_t *font = NULL;
+    uint16_t *_pfbtft = NULL;
+    uint16_t *_allocated = NULL;
+    boolean _use_fbtft = false;
+    bool _asyncActive = false;
+    uint32_t _asyncEnd = 0;
+    double _wire = 0; // seconds of SPI not waited for yet
+
+    static void swap(int16_t &a, int16_t &b)
+    {
+        int16_t t = a;
+        a = b;
+        b = t;
+    }
+
+    void updateDisplayClip()
+    {
+        _displayclipx1 = max((int16_t)0, min((int16_t)(_clipx1 + _originx), _width));
+        _displayclipx2 = max((int16_t)0, min((int16_t)(_clipx2 + _originx), _width));
+        _displayclipy1 = max((int16_t)0, min((int16_t)(_clipy1 + _originy), _height));
+        _displayclipy2 = max((int16_t)0, min((int16_t)(_clipy2 + _originy), _height));
+    }
+
+    // framebuffer, or the display itself
+    uint16_t *frame()
+    {
+        return _use_fbtft ? _pfbtft : panel;
+    }
+
+    // pixel in display coordinates
+    void pixel(int16_t x, int16_t y, uint16_t color)
+    {
+        if (x < _displayclipx1 || x >= _displayclipx2 || y < _displayclipy1 || y >= _displayclipy2)
+            return;
+        frame()[(uint32_t)y * _width + x] = color;
+    }
+
+    // counts what went to the display and waits for its SPI time, drawing into the framebuffer sends nothing
+    void sent(uint32_t addressWindows, uint32_t pixels)
+    {
+        if (_use_fbtft && pixels < (uint32_t)_width * _height)
+            return;
+        windows += addressWindows;
+        pixelsSent += pixels;
+        if (spiMHz > 0)
+            _wire += (addressWindows * 11.0 + pixels * 2.0) * 8.0 / (spiMHz * 1e6);
+        if (!_use_fbtft)
+            wait();
+    }
+
+    // the SPI time of what was sent, in steps of a millisecond
+    void wait()
+    {
+        if (_wire >= 0.001 || _use_fbtft)
+        {
+            delayMicroseconds((uint32_t)(_wire * 1e6));
+            _wire = 0;
+        }
+    }
+
+    static uint32_t bit(const uint8_t *p, uint32_t index)
+    {
+        return (p[index >> 3] >> (7 - (index & 7))) & 1;
+    }
+
+    static uint32_t bits(const uint8_t *p, uint32_t index, uint32_t required)
+    {
+        uint32_t val = 0;
+        while (required--)
+            val = (val << 1) | bit(p, index++);
+        return val;
+    }
+
+    static int32_t signedBits(const uint8_t *p, uint32_t index, uint32_t required)
+    {
+        uint32_t val = bits(p, index, required);
+        if (val & (1 << (required - 1)))
+            return (int32_t)val - (1 << required);
+        return (int32_t)val;
+    }
+
+    const uint8_t *glyph(uint8_t c, uint32_t &bitoffset, uint32_t &width, uint32_t &height, int32_t &xoffset, int32_t &yoffset, uint32_t &delta)
+    {
+        uint32_t index;
+        if (c >= font->index1_first && c <= font->index1_last)
+            index = c - font->index1_first;
+        else if (c >= font->index2_first && c <= font->index2_last)
+            index = c - font->index2_first + font->index1_last - font->index1_first + 1;
+        else
+            return NULL;
+
+        const uint8_t *data = font->data + bits(font->index, index * font->bits_index, font->bits_index);
+        if (bits(data, 0, 3) != 0)
+            return NULL;
+
+        bitoffset = 3;
+        width = bits(data, bitoffset, font->bits_width);
+        bitoffset += font->bits_width;
+        height = bits(data, bitoffset, font->bits_height);
+        bitoffset += font->bits_height;
+        xoffset = signedBits(data, bitoffset, font->bits_xoffset);
+        bitoffset += font->bits_xoffset;
+        yoffset = signedBits(data, bitoffset, font->bits_yoffset);
+        bitoffset += font->bits_yoffset;
+        delta = bits(data, bitoffset, font->bits_delta);
+        bitoffset += font->bits_delta;
+        return data;
+    }
+
+    // cursor handling of ILI9341_t3n, transparent text
+    void drawFontChar(uint8_t c)
+    {
+        uint32_t bitoffset, width, height, delta;
+        int32_t xoffset, yoffset;
+        const uint8_t *data = glyph(c, bitoffset, width, height, xoffset, yoffset, delta);
+        if (data == NULL)
+            return;
+
+        if (cursor_x < 0)
+            cursor_x = 0;
+        int32_t origin_x = cursor_x + xoffset;
+        if (origin_x < 0)
+        {
+            cursor_x -= xoffset;
+            origin_x = 0;
+        }
+        if (origin_x + (int32_t)width > _width)
+        {
+            if (!wrap)
+                return;
+            origin_x = 0;
+            cursor_x = xoffset >= 0 ? 0 : -xoffset;
+            cursor_y += font->line_space;
+        }
+        if (cursor_y >= _height)
+            return;
+
+        int32_t origin_y = cursor_y + font->cap_height - height - yoffset;
+        uint32_t y = 0;
+        uint32_t drawn = 0;
+        while (y < height)
+        {
+            uint32_t repeat = 1;
+            if (bit(data, bitoffset++))
+            {
+                repeat = bits(data, bitoffset, 3) + 2;
+                bitoffset += 3;
+            }
+            for (uint32_t r = 0; r < repeat && y + r < height; r++)
+                for (uint32_t x = 0; x < width; x++)
+                    if (bit(data, bitoffset + x))
+                    {
+                        pixel(origin_x + x + _originx, origin_y + y + r + _originy, textcolor);
+                        drawn++;
+                    }
+            bitoffset += width;
+            y += repeat;
+        }
+        cursor_x += delta;
+        if (drawn > 0)
+            sent(1, (uint32_t)width * height);
+    }
+};
+
+#endif
@@ -0,0 +1,78 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Host backend: XPT2046_Touchscreen with a finger set by the program. press() takes raw values like the
+ * controller gives them (BUI maps them with TS_MINX..TS_MAXY), release() lifts the finger.
+ * With readMicros set, touched() and getPoint() take the time of reading the controller over SPI.
+ */
+
+#ifndef _XPT2046_Touchscreen_h_
+#define _XPT2046_Touchscreen_h_
+
+#include "Arduino.h"
+
+class TS_Point
+{
+public:
+    TS_Point() : x(0), y(0), z(0) {}
+    TS_Point(int16_t x, int16_t y, int16_t z) : x(x), y(y), z(z) {}
+    int16_t x, y, z;
+};
+
+class XPT2046_Touchscreen
+{
+public:
+    uint32_t readMicros = 0; // time of one read
+    uint32_t reads = 0;
+
+    XPT2046_Touchscreen(uint8_t cs, uint8_t tirq = 255)
+    {
+    }
+
+    bool begin()
+    {
+        return true;
+    }
+
+    void setRotation(uint8_t n)
+    {
+    }
+
+    void press(int16_t x, int16_t y, int16_t z = 500)
+    {
+        _point = TS_Point(x, y, z);
+        _touched = true;
+    }
+
+    void release()
+    {
+        _touched = false;
+    }
+
+    bool touched()
+    {
+        read();
+        return _touched;
+    }
+
+    TS_Point getPoint()
+    {
+        read();
+        return _touched ? _point : TS_Point();
+    }
+
+private:
+    TS_Point _point;
+    bool _touched = false;
+
+    void read()
+    {
+        reads++;
+        if (readMicros > 0)
+            delayMicroseconds(readMicros);
+    }
+};
+
+#endif
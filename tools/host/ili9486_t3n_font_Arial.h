@@ -0,0 +1,22 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Host backend: Arial sizes of the library, drawn with the host fonts of the same size (see HostFont.h).
+ */
+
+#ifndef _HOST_FONT_ARIAL_H_
+#define _HOST_FONT_ARIAL_H_
+
+#include "HostFont.h"
+
+static const ILI9486_t3_font_t &Arial_10 = HostFont_10;
+static const ILI9486_t3_font_t &Arial_11 = HostFont_10;
+static const ILI9486_t3_font_t &Arial_12 = HostFont_12;
+static const ILI9486_t3_font_t &Arial_14 = HostFont_14;
+static const ILI9486_t3_font_t &Arial_16 = HostFont_14;
+static const ILI9486_t3_font_t &Arial_20 = HostFont_20;
+static const ILI9486_t3_font_t &Arial_32 = HostFont_32;
+
+#endif
@@ -0,0 +1,21 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Host backend: bold Arial sizes of the library, drawn with the host fonts of the same size (see HostFont.h).
+ */
+
+#ifndef _HOST_FONT_ARIALBOLD_H_
+#define _HOST_FONT_ARIALBOLD_H_
+
+#include "HostFont.h"
+
+static const ILI9486_t3_font_t &Arial_10_Bold = HostFont_10;
+static const ILI9486_t3_font_t &Arial_12_Bold = HostFont_12;
+static const ILI9486_t3_font_t &Arial_14_Bold = HostFont_14;
+static const ILI9486_t3_font_t &Arial_16_Bold = HostFont_14;
+static const ILI9486_t3_font_t &Arial_20_Bold = HostFont_20;
+static const ILI9486_t3_font_t &Arial_32_Bold = HostFont_32;
+
+#endif
@@ -0,0 +1,183 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Host benchmark of the image formats (src/ImageData.h): a 240x160 image is written as BMP, converted by
+ * tools/img2bui.py into raw, rle and indexed .bui files and drawn by an Image control through BUI on the host
+ * display (tools/host), from memory (the file mapped) and read from the file in IMAGEREADBUFFER blocks. The plain
+ * RGB565 array drawn with one writeRect is the reference. Every drawn frame is checked against the source.
+ *
+ *   g++ -std=gnu++17 -O2 -pthread -Itools/host -Isrc -o image_bench tools/image_bench.cpp && ./image_bench
+ *
+ * Run from the root of the repository (it calls python3 tools/img2bui.py), the files are written to /tmp.
+ * Without framebuffer every writeRect is sent, SPI bytes are 2 per pixel plus 11 per address window (column, page
+ * and memory write command). The times are measured on the host (a Teensy is slower), the SPI time is computed for
+ * SPIMHZ.
+ */
+
+#define NOFRAMEBUFFER
+
+#include "ILI9486_t3n.h"
+#include "XPT2046_Touchscreen.h"
+#include "ili9486_t3n_font_Arial.h"
+#include "ili9486_t3n_font_ArialBold.h"
+#include "BUI.h"
+
+#define WIDTH 240
+#define HEIGHT 160
+#define FRAMES 300
+#define WINDOWBYTES 11
+#define SPIMHZ 30
+
+ILI9486_t3n tft(10, 9, 8);
+XPT2046_Touchscreen ts(7);
+
+static const uint16_t palette[16] = {0xFFFF, 0x0000, 0x001F, 0x07E0, 0xF800, 0xFFE0, 0xC618, 0x8410,
+                                     0xEF7D, 0x2104, 0x07FF, 0xF81F, 0xFD20, 0x4208, 0xA514, 0x630C};
+
+// flat areas, frames and a few icons, like a background or a logo
+static void scene(uint16_t *pixels)
+{
+    for (int y = 0; y < HEIGHT; y++)
+        for (int x = 0; x < WIDTH; x++)
+        {
+            int c = y < 24 ? 2 : 8;
+            if (x > 10 && x < 230 && y > 40 && y < 150 && (x % 60 < 2 || y % 40 < 2))
+                c = 6;
+            int dx = x % 60 - 30, dy = y - 95;
+            if (dx * dx + dy * dy < 300)
+                c = 3 + (x / 60);
+            if (y > 4 && y < 20 && x > 8 && x < 120 && ((x * 7 + y * 3) % 5 == 0))
+                c = 0;
+            pixels[y * WIDTH + x] = palette[c];
+        }
+}
+
+// 24 bit top-down BMP, img2bui.py gets the RGB565 colors back exactly
+static bool writeBMP(const char *path, const uint16_t *pixels)
+{
+    FILE *file = fopen(path, "wb");
+    if (file == NULL)
+        return false;
+
+    uint32_t stride = (WIDTH * 3 + 3) & ~3;
+    uint32_t size = 54 + stride * HEIGHT;
+    uint8_t header[54] = {'B', 'M'};
+    memcpy(header + 2, &size, 4);
+    header[10] = 54;
+    header[14] = 40;
+    int32_t width = WIDTH, height = -HEIGHT;
+    memcpy(header + 18, &width, 4);
+    memcpy(header + 22, &height, 4);
+    header[26] = 1;
+    header[28] = 24;
+    fwrite(header, 1, sizeof(header), file);
+
+    uint8_t line[WIDTH * 3 + 3] = {};
+    for (int y = 0; y < HEIGHT; y++)
+    {
+        for (int x = 0; x < WIDTH; x++)
+        {
+            uint16_t c = pixels[y * WIDTH + x];
+            line[x * 3] = (c & 0x1F) << 3;
+            line[x * 3 + 1] = ((c >> 5) & 0x3F) << 2;
+            line[x * 3 + 2] = (c >> 11) << 3;
+        }
+        fwrite(line, 1, stride, file);
+    }
+    return fclose(file) == 0;
+}
+
+static long fileSize(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+        return 0;
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fclose(file);
+    return size;
+}
+
+static uint64_t reference = 0; // SPI bytes per frame of the raw array
+
+static void run(const char *name, Image *image, long size, const uint16_t *source)
+{
+    BUI ui(&tft, &ts);
+    tft.setRotation(1);
+    ui.initNewScreen();
+    ui.enableRedrawOnChange(true);
+    ui.addControl(image);
+    ui.update();
+
+    uint32_t windows = tft.windows;
+    uint32_t pixels = tft.pixelsSent;
+    int wrong = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int n = 0; n < FRAMES; n++)
+    {
+        image->invalidate();
+        ui.update();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    for (int y = 0; y < HEIGHT; y++)
+    {
+        if (memcmp(tft.panel + y * 480, source + y * WIDTH, WIDTH * sizeof(uint16_t)) != 0)
+            wrong++;
+    }
+
+    uint64_t bytes = ((uint64_t)(tft.windows - windows) * WINDOWBYTES + (uint64_t)(tft.pixelsSent - pixels) * 2) / FRAMES;
+    if (reference == 0)
+        reference = bytes;
+    double spi = (double)bytes * 8.0 / (SPIMHZ * 1e6) * 1e3;
+    double spiExtra = (double)(bytes - reference) * 8.0 / (SPIMHZ * 1e6) * 1e3;
+    printf("%-16s %8ld %8.1f %8.1f %8u %10llu %8.2f %8.3f %s\n", name, size, 100.0 * size / (WIDTH * HEIGHT * 2),
+           seconds / FRAMES * 1e6, (tft.windows - windows) / FRAMES, (unsigned long long)bytes, spi, spiExtra,
+           wrong ? "WRONG" : "");
+}
+
+int main()
+{
+    static uint16_t pixels[WIDTH * HEIGHT];
+    scene(pixels);
+    if (!writeBMP("/tmp/image_bench.bmp", pixels))
+        return 1;
+
+    printf("%dx%d image, %d frames, SPI at %d MHz, IMAGECHUNK %d, IMAGEREADBUFFER %d\n\n", WIDTH, HEIGHT, FRAMES, SPIMHZ,
+           IMAGECHUNK, IMAGEREADBUFFER);
+    printf("%-16s %8s %8s %8s %8s %10s %8s %8s\n", "image", "bytes", "% raw", "draw us", "windows", "SPI bytes", "SPI ms",
+           "extra ms");
+
+    Image array(0, 0, WIDTH, HEIGHT, pixels);
+    run("raw array", &array, WIDTH * HEIGHT * 2, pixels);
+
+    const char *formats[] = {"raw", "rle", "indexed"};
+    char command[200], path[40], name[40];
+    for (const char *format : formats)
+    {
+        snprintf(path, sizeof(path), "/tmp/image_bench_%s.bui", format);
+        snprintf(command, sizeof(command), "python3 tools/img2bui.py /tmp/image_bench.bmp -f %s --bin -o %s >/dev/null 2>&1",
+                 format, path);
+        if (system(command) != 0)
+        {
+            printf("%s: img2bui.py failed (run from the root of the repository)\n", path);
+            return 1;
+        }
+
+        for (int mapped = 1; mapped >= 0; mapped--)
+        {
+            HostImageSource source;
+            FileImage file;
+            if (!source.open(path, mapped) || !file.begin(&source))
+            {
+                printf("%s: not loaded\n", path);
+                return 1;
+            }
+            Image image(0, 0, &file.image);
+            snprintf(name, sizeof(name), "%s %s", format, mapped ? "memory" : "file");
+            run(name, &image, fileSize(path), pixels);
+        }
+    }
+    return 0;
+}
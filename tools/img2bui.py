@@ -0,0 +1,325 @@
+#!/usr/bin/env python3
+"""
+Author: https://github.com/sepp89117/
+Source: https://github.com/sepp89117/Teensy_UI
+Date: 2026-10-19
+
+Converts PNG or BMP files into a C header with an ImageData for Teensy_UI (see src/ImageData.h).
+
+    python3 img2bui.py logo.png                 # smallest of raw, rle and indexed
+    python3 img2bui.py logo.png -f indexed -o logo.h -n logo
+    python3 img2bui.py logo.bmp -f rle --background 0xFFFF
+    python3 img2bui.py background.png --bin     # .bui file for FileImage (SD card or host file)
+
+Only the Python standard library is needed.
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+
+# ---------------------------------------------------------------- reading images
+
+def read_png(raw):
+    pos = 8
+    chunks = []
+    while pos < len(raw):
+        length, kind = struct.unpack(">I4s", raw[pos:pos + 8])
+        chunks.append((kind, raw[pos + 8:pos + 8 + length]))
+        pos += 12 + length
+
+    header = dict(chunks)[b"IHDR"]
+    width, height, depth, color_type, _, _, interlace = struct.unpack(">IIBBBBB", header)
+    if interlace:
+        raise ValueError("interlaced PNG is not supported")
+
+    palette = []
+    transparency = b""
+    data = b""
+    for kind, body in chunks:
+        if kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"tRNS":
+            transparency = body
+        elif kind == b"IDAT":
+            data += body
+    data = zlib.decompress(data)
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color_type]
+    bits_per_pixel = channels * depth
+    stride = (width * bits_per_pixel + 7) // 8
+    step = max(1, bits_per_pixel // 8)
+
+    # unfilter
+    rows = []
+    previous = bytearray(stride)
+    pos = 0
+    for _ in range(height):
+        kind = data[pos]
+        line = bytearray(data[pos + 1:pos + 1 + stride])
+        pos += 1 + stride
+        for i in range(stride):
+            left = line[i - step] if i >= step else 0
+            up = previous[i]
+            up_left = previous[i - step] if i >= step else 0
+            if kind == 1:
+                line[i] = (line[i] + left) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + up) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + ((left + up) >> 1)) & 0xFF
+            elif kind == 4:
+                p = left + up - up_left
+                pa, pb, pc = abs(p - left), abs(p - up), abs(p - up_left)
+                predictor = left if pa <= pb and pa <= pc else (up if pb <= pc else up_left)
+                line[i] = (line[i] + predictor) & 0xFF
+        rows.append(line)
+        previous = line
+
+    def samples(line):
+        if depth == 8:
+            return list(line)
+        if depth == 16:
+            return list(line[0::2])
+        mask = (1 << depth) - 1
+        return [(byte >> (8 - depth - bit)) & mask for byte in line for bit in range(0, 8, depth)]
+
+    pixels = []
+    for line in rows:
+        values = samples(line)
+        row = []
+        for x in range(width):
+            v = values[x * channels:(x + 1) * channels]
+            if color_type == 0:
+                scale = 255 // ((1 << depth) - 1) if depth < 8 else 1
+                row.append((v[0] * scale,) * 3 + (255,))
+            elif color_type == 2:
+                row.append(tuple(v) + (255,))
+            elif color_type == 3:
+                alpha = transparency[v[0]] if v[0] < len(transparency) else 255
+                row.append(palette[v[0]] + (alpha,))
+            elif color_type == 4:
+                row.append((v[0],) * 3 + (v[1],))
+            else:
+                row.append(tuple(v))
+        pixels.append(row)
+    return width, height, pixels
+
+
+def read_bmp(raw):
+    offset = struct.unpack("<I", raw[10:14])[0]
+    header_size = struct.unpack("<I", raw[14:18])[0]
+    width, height, _, bits, compression = struct.unpack("<iiHHI", raw[18:34])
+    if compression not in (0, 3):
+        raise ValueError("compressed BMP is not supported")
+
+    top_down = height < 0
+    height = abs(height)
+    palette = []
+    if bits <= 8:
+        start = 14 + header_size
+        for i in range(1 << bits):
+            b, g, r, _ = raw[start + i * 4:start + i * 4 + 4]
+            palette.append((r, g, b, 255))
+
+    stride = ((width * bits + 31) // 32) * 4
+    pixels = []
+    for y in range(height):
+        line = raw[offset + y * stride:offset + (y + 1) * stride]
+        row = []
+        for x in range(width):
+            if bits == 32:
+                b, g, r, a = line[x * 4:x * 4 + 4]
+                row.append((r, g, b, a if compression == 0 else 255))
+            elif bits == 24:
+                b, g, r = line[x * 3:x * 3 + 3]
+                row.append((r, g, b, 255))
+            elif bits == 16:
+                v = struct.unpack("<H", line[x * 2:x * 2 + 2])[0]
+                row.append((((v >> 10) & 0x1F) << 3, ((v >> 5) & 0x1F) << 3, (v & 0x1F) << 3, 255))
+            else:
+                bit = x * bits
+                index = (line[bit // 8] >> (8 - bits - bit % 8)) & ((1 << bits) - 1)
+                row.append(palette[index])
+        pixels.append(row)
+    if not top_down:
+        pixels.reverse()
+    return width, height, pixels
+
+
+def read_image(path):
+    with open(path, "rb") as f:
+        raw = f.read()
+    if raw[:8] == b"\x89PNG\r\n\x1a\n":
+        return read_png(raw)
+    if raw[:2] == b"BM":
+        return read_bmp(raw)
+    raise ValueError("%s is neither PNG nor BMP" % path)
+
+
+def to565(pixel, background):
+    r, g, b, a = pixel
+    if a < 255:
+        br, bg, bb = (background >> 8) & 0xF8, (background >> 3) & 0xFC, (background << 3) & 0xF8
+        r = (r * a + br * (255 - a)) // 255
+        g = (g * a + bg * (255 - a)) // 255
+        b = (b * a + bb * (255 - a)) // 255
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+# ---------------------------------------------------------------- encoding
+
+def encode_rle(values, value_bytes):
+    def pack(v):
+        return struct.pack("<H", v) if value_bytes == 2 else bytes((v,))
+
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            part = literal[:128]
+            del literal[:128]
+            out.append(len(part) - 1)
+            for v in part:
+                out.extend(pack(v))
+
+    i = 0
+    while i < len(values):
+        run = 1
+        while i + run < len(values) and run < 128 and values[i + run] == values[i]:
+            run += 1
+        if run >= 2:
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out.extend(pack(values[i]))
+            i += run
+        else:
+            literal.append(values[i])
+            i += 1
+    flush_literal()
+    return bytes(out)
+
+
+def encode_indexed(indices, width, bpp):
+    out = bytearray()
+    for y in range(0, len(indices), width):
+        byte = 0
+        bit = 0
+        for index in indices[y:y + width]:
+            byte |= index << (8 - bpp - bit)
+            bit += bpp
+            if bit == 8:
+                out.append(byte)
+                byte = 0
+                bit = 0
+        if bit:
+            out.append(byte)
+    return bytes(out)
+
+
+def encode(width, height, pixels, fmt, background):
+    colors = [to565(p, background) for row in pixels for p in row]
+    palette = sorted(set(colors))
+    candidates = {}
+
+    if fmt in ("raw", "auto"):
+        candidates["raw"] = ("IMG_RAW", 16, None, struct.pack("<%dH" % len(colors), *colors))
+
+    if fmt in ("rle", "auto"):
+        if len(palette) <= 256:
+            lookup = {c: i for i, c in enumerate(palette)}
+            candidates["rle"] = ("IMG_RLE", 8, palette, encode_rle([lookup[c] for c in colors], 1))
+        else:
+            candidates["rle"] = ("IMG_RLE", 16, None, encode_rle(colors, 2))
+
+    if fmt in ("indexed", "auto"):
+        if len(palette) > 256:
+            if fmt == "indexed":
+                raise ValueError("%d colors, indexed images can hold 256 at most" % len(palette))
+        else:
+            bpp = next(b for b in (1, 2, 4, 8) if len(palette) <= 1 << b)
+            lookup = {c: i for i, c in enumerate(palette)}
+            # a color for every index, FileImage rejects shorter palettes
+            padded = palette + [0] * ((1 << bpp) - len(palette))
+            candidates["indexed"] = ("IMG_INDEXED", bpp, padded, encode_indexed([lookup[c] for c in colors], width, bpp))
+
+    def size(item):
+        _, _, pal, data = item[1]
+        return len(data) + (len(pal) * 2 if pal else 0)
+
+    return min(candidates.items(), key=size)
+
+
+# ---------------------------------------------------------------- output
+
+def c_array(kind, name, values, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(values[i:i + per_line]) + ",")
+    return "const %s %s[] PROGMEM = {\n%s\n};\n" % (kind, name, "\n".join(lines))
+
+
+def write_header(path, name, width, height, result, source):
+    label, (fmt, bpp, palette, data) = result
+    out = ["// %s: %dx%d, %s, %d bytes (generated by tools/img2bui.py)\n" % (
+        os.path.basename(source), width, height, label, len(data) + (len(palette) * 2 if palette else 0))]
+
+    if palette:
+        out.append(c_array("uint16_t", name + "_palette", ["0x%04X" % c for c in palette], 12))
+    if fmt == "IMG_RAW":
+        words = struct.unpack("<%dH" % (len(data) // 2), data)
+        out.append(c_array("uint16_t", name + "_data", ["0x%04X" % w for w in words], 12))
+    else:
+        out.append(c_array("uint8_t", name + "_data", ["0x%02X" % b for b in data], 16))
+
+    out.append("const ImageData %s = {%d, %d, %s, %d, %s, %s_data};\n" % (
+        name, width, height, fmt, bpp, name + "_palette" if palette else "NULL", name))
+
+    with open(path, "w") as f:
+        f.write("\n".join(out))
+
+
+def write_bin(path, width, height, result):
+    _, (fmt, bpp, palette, data) = result
+    formats = {"IMG_RAW": 0, "IMG_RLE": 1, "IMG_INDEXED": 2}
+    palette = palette or []
+    with open(path, "wb") as f:
+        f.write(b"BUI1" + struct.pack("<HHBBH", width, height, formats[fmt], bpp, len(palette)))
+        f.write(struct.pack("<%dH" % len(palette), *palette))
+        f.write(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="convert PNG/BMP to a Teensy_UI ImageData header")
+    parser.add_argument("image")
+    parser.add_argument("-o", "--output", help="file to write (default: <image>.h or <image>.bui)")
+    parser.add_argument("-n", "--name", help="C name of the image (default: from file name)")
+    parser.add_argument("-f", "--format", choices=("auto", "raw", "rle", "indexed"), default="auto")
+    parser.add_argument("--background", default="0x0000", help="RGB565 color behind transparent pixels")
+    parser.add_argument("--bin", action="store_true", help="write a .bui file instead of a C header")
+    args = parser.parse_args()
+
+    name = args.name or re.sub(r"\W", "_", os.path.splitext(os.path.basename(args.image))[0])
+    output = args.output or os.path.splitext(args.image)[0] + (".bui" if args.bin else ".h")
+
+    width, height, pixels = read_image(args.image)
+    result = encode(width, height, pixels, args.format, int(args.background, 0))
+    if args.bin:
+        write_bin(output, width, height, result)
+    else:
+        write_header(output, name, width, height, result, args.image)
+
+    raw_size = width * height * 2
+    _, (_, _, palette, data) = result
+    size = len(data) + (len(palette) * 2 if palette else 0)
+    print("%s: %dx%d %s, %d of %d bytes (%.0f%%)" % (
+        output, width, height, result[0], size, raw_size, 100.0 * size / raw_size), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,153 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Host benchmark of the pipelined BUI (PIPELINE): updates per second of a busy dashboard with update() drawing and
+ * sending every frame, with the frames sent by DMA (enableAsyncUpdate) and with the render task (enablePipeline).
+ * The last frame of every mode is checked against the one of update().
+ *
+ *   g++ -std=gnu++17 -O2 -pthread -Itools/host -Isrc -o pipeline_bench tools/pipeline_bench.cpp && ./pipeline_bench
+ *
+ * The display and the touch controller are the ones of tools/host: sending a frame and reading the touch controller
+ * wait for the time they take over SPI, the sketch waits for a sensor before every update. Drawing takes the time
+ * of the host. The scenarios set these times; with one core, only the waits can overlap with drawing.
+ */
+
+#define PIPELINE
+
+#include "ILI9486_t3n.h"
+#include "XPT2046_Touchscreen.h"
+#include "ili9486_t3n_font_Arial.h"
+#include "ili9486_t3n_font_ArialBold.h"
+#include "BUI.h"
+
+#define FRAMES 120
+#define RECORDOPS 1500
+#define RECORDPIXELS 8192
+
+DisplayList tft(10, 9, 8);
+XPT2046_Touchscreen ts(7);
+
+// dashboard, the values change every frame
+float history[240];
+float levels[4];
+float load;
+float temperature;
+int32_t counter;
+
+BarGraph bars[4] = {
+    BarGraph(10, 10, 60, 150, 0, 100, 0x07E0, (char *)"A"),
+    BarGraph(80, 10, 60, 150, 0, 100, 0x001F, (char *)"B"),
+    BarGraph(150, 10, 60, 150, 0, 100, 0xF800, (char *)"C"),
+    BarGraph(220, 10, 60, 150, 0, 100, 0xFFE0, (char *)"D")};
+DonutGraph donut = DonutGraph(300, 10, 0, 100, 0x07FF, (char *)"Load");
+LineChart chart = LineChart(10, 180, 300, 130, history, 240, 0xF81F, (char *)"History");
+NumericLabel lblLoad = NumericLabel(330, 200, &load, 1, Arial_14);
+NumericLabel lblTemperature = NumericLabel(330, 230, &temperature, 2, Arial_14);
+NumericLabel lblCounter = NumericLabel(330, 260, &counter, 0, Arial_14);
+Slider slider = Slider(330, 290, 140, 24, 0, 100);
+Button button = Button(400, 200, 70, 30, (char *)"Reset");
+
+static void values(uint32_t frame)
+{
+    for (int i = 0; i < 4; i++)
+        levels[i] = 50 + 45 * sinf(frame * 0.05f * (i + 1));
+    load = 50 + 40 * sinf(frame * 0.031f);
+    temperature = 21.5f + 3 * cosf(frame * 0.017f);
+    counter = frame;
+
+    for (int i = 0; i < 4; i++)
+        bars[i].setValue(levels[i]);
+    donut.setValue(load);
+    slider.setValue(levels[0]);
+    chart.addSample(load);
+}
+
+FrameOp ops[2][RECORDOPS];
+uint16_t pixels[2][RECORDPIXELS];
+FrameRecord records[2] = {{ops[0], RECORDOPS, pixels[0], RECORDPIXELS}, {ops[1], RECORDOPS, pixels[1], RECORDPIXELS}};
+
+enum
+{
+    SYNC,
+    ASYNC,
+    PIPELINED,
+    PIPELINEDASYNC
+};
+
+static uint16_t reference[480 * 320];
+
+struct scenario
+{
+    const char *name;
+    float spiMHz;          // 0: sending takes no time
+    uint32_t touchMicros;  // read of the touch controller
+    uint32_t sensorMicros; // the sketch waits for a sensor before every update
+};
+
+static void run(const char *name, int mode, uint32_t sensorMicros)
+{
+    memset(history, 0, sizeof(history));
+    chart.clear();
+
+    BUI ui(&tft, &ts);
+    tft.setRotation(1);
+    ui.initNewScreen();
+    ui.enableRedrawOnChange(true);
+    for (int i = 0; i < 4; i++)
+        ui.addControl(&bars[i]);
+    ui.addControl(&donut);
+    ui.addControl(&chart);
+    ui.addControl(&lblLoad);
+    ui.addControl(&lblTemperature);
+    ui.addControl(&lblCounter);
+    ui.addControl(&slider);
+    ui.addControl(&button);
+
+    ui.enableAsyncUpdate(mode == ASYNC || mode == PIPELINEDASYNC);
+    if (mode == PIPELINED || mode == PIPELINEDASYNC)
+        ui.enablePipeline(records, 2);
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t frame = 0; frame < FRAMES; frame++)
+    {
+        if (sensorMicros > 0)
+            delayMicroseconds(sensorMicros);
+        values(frame);
+        ui.update();
+    }
+    ui.enablePipeline(NULL, 0);
+    ui.enableAsyncUpdate(false);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const char *check = "";
+    if (mode == SYNC)
+        memcpy(reference, tft.panel, sizeof(reference));
+    else if (memcmp(reference, tft.panel, sizeof(reference)) != 0)
+        check = "DIFFERENT";
+
+    printf("  %-16s %10.1f %10.2f %s\n", name, FRAMES / seconds, seconds / FRAMES * 1e3, check);
+}
+
+int main()
+{
+    const scenario scenarios[] = {
+        {"drawing only", 0, 0, 0},
+        {"SPI 60 MHz, touch 300 us", 60, 300, 0},
+        {"SPI 60 MHz, touch 300 us, sensor 20 ms", 60, 300, 20000},
+        {"SPI 80 MHz, touch 300 us, sensor 5 ms", 80, 300, 5000}};
+
+    printf("%d frames of a dashboard, %u cores on this host\n", FRAMES, std::thread::hardware_concurrency());
+    for (const scenario &s : scenarios)
+    {
+        tft.spiMHz = s.spiMHz;
+        ts.readMicros = s.touchMicros;
+        printf("\n%s\n  %-16s %10s %10s\n", s.name, "mode", "updates/s", "ms/update");
+        run("update()", SYNC, s.sensorMicros);
+        run("async", ASYNC, s.sensorMicros);
+        run("pipeline", PIPELINED, s.sensorMicros);
+        run("pipeline+async", PIPELINEDASYNC, s.sensorMicros);
+    }
+    return 0;
+}
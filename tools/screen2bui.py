@@ -0,0 +1,288 @@
+#!/usr/bin/env python3
+"""
+Author: https://github.com/sepp89117/
+Source: https://github.com/sepp89117/Teensy_UI
+Date: 2026-10-19
+
+Compiles a JSON screen description into a screen for Screen::load() (see src/ScreenData.h).
+
+    python3 screen2bui.py settings.json                # settings.h with the screen and settings_load()
+    python3 screen2bui.py settings.json --bin          # settings.bus for a file on SD or the host
+
+    {
+        "background": "0xFFFF",
+        "controls": [
+            {"type": "label", "x": 10, "y": 10, "text": "Settings", "font": "Arial_16"},
+            {"type": "slider", "name": "volume", "x": 10, "y": 40, "w": 200, "h": 24, "min": 0, "max": 100,
+             "value": "volume"},
+            {"type": "dropdown", "x": 10, "y": 80, "w": 120, "options": ["low", "high"], "selected": 0},
+            {"type": "button", "x": 10, "y": 120, "w": 100, "h": 30, "text": "Save", "handler": "onSave",
+             "image": "save.png"}
+        ]
+    }
+
+Fonts, values (Observable) and handlers are referred to by their C names; they go into tables in the order they
+are used first. With --bin the order is printed, the sketch passes the same tables to setFonts(), setValues()
+and setHandlers(). Images are PNG or BMP files (relative to the JSON file), converted like img2bui.py does.
+
+Control keys: type, name, x, y, w, h, text, font, value, handler, fore, back, color, min, max, options, selected,
+checked, disabled, opaque, align, image.
+
+Only the Python standard library is needed.
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+from img2bui import encode, read_image
+
+MAGIC = b"BUS1"
+HEADER = "<4sHHHHI"
+RECORD = "<BBBBhhHHHHffIIBBH"
+RECORD_SIZE = 36
+NONE = 0xFF
+
+# header flags
+BACKCOLOR = 0x01
+
+# record flags
+DISABLED = 0x01
+OPAQUE = 0x02
+CHECKED = 0x04
+COLORS = 0x08
+
+TYPES = {
+    "button": 1,
+    "label": 2,
+    "checkbox": 3,
+    "slider": 4,
+    "numericupdown": 5,
+    "bargraph": 6,
+    "donutgraph": 7,
+    "image": 8,
+    "dropdown": 9,
+    "textbox": 10,
+    "box": 12,
+}
+
+ALIGNS = {"left": 0, "center": 1, "right": 2}
+FORMATS = {"IMG_RAW": 0, "IMG_RLE": 1, "IMG_INDEXED": 2}
+
+# defaults of the constructors
+DEFAULT_FORE = 0x0000
+DEFAULT_BACK = 0xFFDF
+DEFAULT_COLOR = 0x001F
+
+
+def color(value):
+    return int(value, 0) if isinstance(value, str) else int(value)
+
+
+class Compiler:
+    def __init__(self, base):
+        self.base = base
+        self.fonts = []
+        self.values = []
+        self.handlers = []
+        self.data = bytearray()
+        self.strings = {}
+
+    def index(self, table, name):
+        if name is None:
+            return NONE
+        if name not in table:
+            if len(table) >= NONE:
+                raise ValueError("more than %d fonts, values or handlers" % (NONE - 1))
+            table.append(name)
+        return table.index(name)
+
+    def align(self):
+        self.data += b"\0" * (-len(self.data) % 4)
+
+    # offsets are relative to the data, fixed up once the size of the records is known
+    def text(self, text):
+        if text is None:
+            return None
+        if text not in self.strings:
+            self.strings[text] = len(self.data)
+            self.data += text.encode("latin-1") + b"\0"
+        return self.strings[text]
+
+    def options(self, options):
+        offset = len(self.data)
+        for option in options:
+            if option == "":
+                raise ValueError("empty DropDown option")
+            self.data += option.encode("latin-1") + b"\0"
+        self.data += b"\0"
+        return offset
+
+    def image(self, path, fmt, background):
+        width, height, pixels = read_image(os.path.join(self.base, path))
+        _, (kind, bpp, palette, data) = encode(width, height, pixels, fmt, background)
+        palette = palette or []
+
+        # palette and RGB565 data are read as words in place
+        self.align()
+        offset = len(self.data)
+        self.data += b"BUI1" + struct.pack("<HHBBH", width, height, FORMATS[kind], bpp, len(palette))
+        self.data += struct.pack("<%dH" % len(palette), *palette)
+        self.data += data
+        return offset
+
+    def record(self, control, fmt):
+        kind = control.get("type", "").lower()
+        if kind not in TYPES:
+            raise ValueError("unknown control type '%s'" % control.get("type"))
+
+        flags = 0
+        if control.get("disabled"):
+            flags |= DISABLED
+        if control.get("opaque"):
+            flags |= OPAQUE
+        if control.get("checked"):
+            flags |= CHECKED
+        if "fore" in control or "back" in control:
+            flags |= COLORS
+
+        fore = color(control.get("fore", DEFAULT_FORE))
+        back = color(control.get("back", DEFAULT_BACK))
+        if kind in ("bargraph", "donutgraph", "box"):
+            # the color of the constructor
+            if ("back" if kind == "box" else "fore") in control:
+                raise ValueError("%s: use 'color' instead of 'fore' and 'back'" % kind)
+            value = color(control.get("color", DEFAULT_COLOR))
+            if kind == "box":
+                back = value
+            else:
+                fore = value
+
+        low = control.get("min", 0)
+        high = control.get("max", 100)
+        text = None
+        if kind == "dropdown":
+            text = self.options(control.get("options", []))
+            low = control.get("selected", -1)
+        else:
+            text = self.text(control.get("text"))
+
+        image = None
+        if "image" in control:
+            image = self.image(control["image"], fmt, color(control.get("imageBackground", back)))
+
+        return [
+            TYPES[kind],
+            self.index(self.fonts, control.get("font")),
+            self.index(self.values, control.get("value")),
+            self.index(self.handlers, control.get("handler")),
+            control.get("x", 0),
+            control.get("y", 0),
+            control.get("w", 0),
+            control.get("h", 0),
+            fore,
+            back,
+            low,
+            high,
+            text,
+            image,
+            flags,
+            ALIGNS[control.get("align", "left")],
+            0,
+        ]
+
+    def compile(self, screen, fmt):
+        controls = screen.get("controls", [])
+        records = [self.record(c, fmt) for c in controls]
+
+        start = struct.calcsize(HEADER) + RECORD_SIZE * len(records)
+        size = start + len(self.data)
+        size += -size % 4
+
+        flags = 0
+        background = 0
+        if "background" in screen:
+            flags |= BACKCOLOR
+            background = color(screen["background"])
+
+        out = bytearray(struct.pack(HEADER, MAGIC, len(records), RECORD_SIZE, background, flags, size))
+        for r in records:
+            # 0 = no text or image
+            r[12] = start + r[12] if r[12] is not None else 0
+            r[13] = start + r[13] if r[13] is not None else 0
+            out += struct.pack(RECORD, *r)
+        out += self.data
+        out += b"\0" * (size - len(out))
+
+        names = [(c["name"], i) for i, c in enumerate(controls) if "name" in c]
+        return bytes(out), names
+
+
+# ---------------------------------------------------------------- output
+
+def write_header(path, name, data, names, compiler, source):
+    out = ["// %s: %d bytes (generated by tools/screen2bui.py)\n" % (os.path.basename(source), len(data))]
+
+    if names:
+        out.append("".join("#define %s_%s %d\n" % (name.upper(), re.sub(r"\W", "_", n).upper(), i) for n, i in names))
+
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    out.append("const uint8_t %s[] PROGMEM __attribute__((aligned(4))) = {\n%s\n};\n" % (name, "\n".join(lines)))
+
+    # tables of the names the screen refers to, they have to be declared before this header
+    load = []
+    if compiler.fonts:
+        out.append("const FONTS *const %s_fonts[] = {%s};\n" % (name, ", ".join("&" + f for f in compiler.fonts)))
+        load.append("    screen.setFonts(%s_fonts, %d);" % (name, len(compiler.fonts)))
+    if compiler.values:
+        out.append("Observable *const %s_values[] = {%s};\n" % (name, ", ".join("&" + v for v in compiler.values)))
+        load.append("    screen.setValues(%s_values, %d);" % (name, len(compiler.values)))
+    if compiler.handlers:
+        out.append("void (*const %s_handlers[])() = {%s};\n" % (name, ", ".join(compiler.handlers)))
+        load.append("    screen.setHandlers(%s_handlers, %d);" % (name, len(compiler.handlers)))
+    load.append("    return screen.load(&ui, %s);" % name)
+    out.append("inline bool %s_load(Screen &screen, BUI &ui)\n{\n%s\n}\n" % (name, "\n".join(load)))
+
+    with open(path, "w") as f:
+        f.write("\n".join(out))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="compile a JSON screen description for Teensy_UI")
+    parser.add_argument("screen")
+    parser.add_argument("-o", "--output", help="file to write (default: <screen>.h or <screen>.bus)")
+    parser.add_argument("-n", "--name", help="C name of the screen (default: from file name)")
+    parser.add_argument("-f", "--format", choices=("auto", "raw", "rle", "indexed"), default="auto",
+                        help="format of the images")
+    parser.add_argument("--bin", action="store_true", help="write a .bus file instead of a C header")
+    args = parser.parse_args()
+
+    name = args.name or re.sub(r"\W", "_", os.path.splitext(os.path.basename(args.screen))[0])
+    output = args.output or os.path.splitext(args.screen)[0] + (".bus" if args.bin else ".h")
+
+    with open(args.screen) as f:
+        screen = json.load(f)
+    compiler = Compiler(os.path.dirname(os.path.abspath(args.screen)))
+    data, names = compiler.compile(screen, args.format)
+
+    if args.bin:
+        with open(output, "wb") as f:
+            f.write(data)
+        for title, table in (("fonts", compiler.fonts), ("values", compiler.values), ("handlers", compiler.handlers)):
+            if table:
+                print("%s: %s" % (title, ", ".join(table)), file=sys.stderr)
+        for n, i in names:
+            print("control %d: %s" % (i, n), file=sys.stderr)
+    else:
+        write_header(output, name, data, names, compiler, args.screen)
+
+    print("%s: %d controls, %d bytes" % (output, len(screen.get("controls", [])), len(data)), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,136 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Host benchmark of the TileRenderer (src/TileRenderer.h): one full frame of a busy dashboard is recorded like the
+ * pipelined BUI does it, then drawn into the framebuffer again and again by DisplayList::replay() and by the
+ * TileRenderer on 1 .. N threads (N: the cores of the host, at least 4). Every frame is checked against replay().
+ *
+ *   g++ -std=gnu++17 -O2 -pthread -Itools/host -Isrc -o tilerender_bench tools/tilerender_bench.cpp && ./tilerender_bench
+ *
+ * Only the drawing of the records is timed, sending takes no time. More threads than cores cannot be faster.
+ */
+
+#define PIPELINE
+
+#include "ILI9486_t3n.h"
+#include "XPT2046_Touchscreen.h"
+#include "ili9486_t3n_font_Arial.h"
+#include "ili9486_t3n_font_ArialBold.h"
+#include "BUI.h"
+
+#define FRAMES 400
+#define PANELPIXELS (480 * 320)
+
+DisplayList tft(10, 9, 8);
+XPT2046_Touchscreen ts(7);
+
+// dashboard of 19 controls
+float history[240];
+float value = 42;
+uint16_t picture[120 * 80];
+
+BarGraph bars[6] = {
+    BarGraph(10, 10, 40, 140, 0, 100, 0x07E0, (char *)"A"),
+    BarGraph(55, 10, 40, 140, 0, 100, 0x001F, (char *)"B"),
+    BarGraph(100, 10, 40, 140, 0, 100, 0xF800, (char *)"C"),
+    BarGraph(145, 10, 40, 140, 0, 100, 0xFFE0, (char *)"D"),
+    BarGraph(190, 10, 40, 140, 0, 100, 0x07FF, (char *)"E"),
+    BarGraph(235, 10, 40, 140, 0, 100, 0xF81F, (char *)"F")};
+DonutGraph donuts[2] = {DonutGraph(290, 10, 0, 100, 0x07FF, (char *)"Load"), DonutGraph(385, 10, 0, 100, 0xFD20, (char *)"Fan")};
+LineChart chart = LineChart(10, 165, 280, 145, history, 240, 0xF81F, (char *)"History");
+NumericLabel labels[4] = {NumericLabel(300, 110, &value, 1, Arial_14), NumericLabel(390, 110, &value, 2, Arial_14),
+                          NumericLabel(300, 140, &value, 0, Arial_20), NumericLabel(390, 140, &value, 3, Arial_20)};
+Slider slider = Slider(300, 290, 170, 24, 0, 100);
+Button button = Button(430, 250, 45, 30, (char *)"OK");
+Image image = Image(300, 170, 120, 80, picture);
+Label title = Label(300, 255, (char *)"Dashboard", Arial_14);
+
+FrameOp ops[30000];
+uint16_t pixels[100000];
+FrameRecord record(ops, 30000, pixels, 100000);
+uint16_t bins[60000];
+static uint16_t reference[PANELPIXELS];
+
+// ms per frame, the frame is checked against reference
+static double time(TileRenderer *tiles, uint16_t *frame, bool *same)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < FRAMES; i++)
+    {
+        if (tiles == NULL)
+            tft.replay(&record);
+        else
+            tiles->render(&record, frame, 480, 320);
+    }
+    double ms = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() * 1e3 / FRAMES;
+    *same = memcmp(frame, reference, sizeof(reference)) == 0;
+    return ms;
+}
+
+int main()
+{
+    for (int i = 0; i < 240; i++)
+        history[i] = 50 + 40 * sinf(i * 0.1f);
+    for (int i = 0; i < 120 * 80; i++)
+        picture[i] = i * 2654435761u >> 16;
+
+    BUI ui(&tft, &ts);
+    tft.setRotation(1);
+    ui.initNewScreen();
+    for (int i = 0; i < 6; i++)
+    {
+        bars[i].setValue(15 * i + 10);
+        ui.addControl(&bars[i]);
+    }
+    for (int i = 0; i < 2; i++)
+    {
+        donuts[i].setValue(30 + 40 * i);
+        ui.addControl(&donuts[i]);
+    }
+    for (int i = 0; i < 240; i++)
+        chart.addSample(history[i]);
+    ui.addControl(&chart);
+    for (int i = 0; i < 4; i++)
+        ui.addControl(&labels[i]);
+    ui.addControl(&slider);
+    ui.addControl(&button);
+    ui.addControl(&image);
+    ui.addControl(&title);
+
+    // one full frame into the record by the pipeline, the render task draws it into the framebuffer
+    ui.enablePipeline(&record, 1);
+    ui.update();
+    ui.enablePipeline(NULL, 0);
+    if (tft.getRecordsSplit() > 0)
+    {
+        printf("the frame does not fit into the record\n");
+        return 1;
+    }
+
+    uint16_t *frame = tft.getFrameBuffer();
+    memcpy(reference, frame, sizeof(reference));
+
+    uint8_t cores = std::thread::hardware_concurrency();
+    uint8_t most = min(max((int)cores, 4), MAXRENDERTHREADS);
+    printf("%u ops, %u pixels in the frame, %u cores on this host, %d frames\n\n", record.count, record.used, cores, FRAMES);
+    printf("  %-22s %10s %10s %s\n", "", "ms/frame", "speedup", "");
+
+    bool same;
+    double serial = time(NULL, frame, &same);
+    printf("  %-22s %10.3f %10.2f\n", "replay()", serial, 1.0);
+
+    char name[32];
+    for (uint8_t threads = 1; threads <= most; threads++)
+    {
+        TileRenderer tiles(bins, sizeof(bins) / sizeof(bins[0]));
+        if (!tiles.begin(threads))
+            return 1;
+        double ms = time(&tiles, frame, &same);
+        snprintf(name, sizeof(name), "tiles, %u threads", threads);
+        printf("  %-22s %10.3f %10.2f %s %s\n", name, ms, serial / ms, tiles.getBinned() ? "" : "(not binned)",
+               same ? "" : "DIFFERENT");
+    }
+    return 0;
+}
@@ -0,0 +1,181 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Host test of the TileRenderer (src/TileRenderer.h): a busy dashboard is drawn by update() without the pipeline,
+ * then with the pipeline replaying the records in the render task and with the TileRenderer on 1..4 threads, with
+ * and without bins and with records too small for a frame. Every frame has to be the same, bit for bit.
+ *
+ *   g++ -std=gnu++17 -O2 -pthread -Itools/host -Isrc -o tilerender_test tools/tilerender_test.cpp && ./tilerender_test
+ *
+ * Exits with 1 at the first frame that differs.
+ */
+
+#define PIPELINE
+
+#include "ILI9486_t3n.h"
+#include "XPT2046_Touchscreen.h"
+#include "ili9486_t3n_font_Arial.h"
+#include "ili9486_t3n_font_ArialBold.h"
+#include "BUI.h"
+
+#define FRAMES 60
+#define PANELPIXELS (480 * 320)
+
+DisplayList tft(10, 9, 8);
+XPT2046_Touchscreen ts(7);
+
+// dashboard, the values change every frame
+float history[240];
+float levels[4];
+float load;
+float temperature;
+int32_t counter;
+uint16_t picture[64 * 48];
+
+BarGraph bars[4] = {
+    BarGraph(10, 10, 60, 150, 0, 100, 0x07E0, (char *)"A"),
+    BarGraph(80, 10, 60, 150, 0, 100, 0x001F, (char *)"B"),
+    BarGraph(150, 10, 60, 150, 0, 100, 0xF800, (char *)"C"),
+    BarGraph(220, 10, 60, 150, 0, 100, 0xFFE0, (char *)"D")};
+DonutGraph donut = DonutGraph(300, 10, 0, 100, 0x07FF, (char *)"Load");
+LineChart chart = LineChart(10, 180, 300, 130, history, 240, 0xF81F, (char *)"History");
+NumericLabel lblLoad = NumericLabel(330, 200, &load, 1, Arial_14);
+NumericLabel lblTemperature = NumericLabel(330, 230, &temperature, 2, Arial_14);
+NumericLabel lblCounter = NumericLabel(330, 260, &counter, 0, Arial_14);
+Slider slider = Slider(330, 290, 140, 24, 0, 100);
+Button button = Button(400, 200, 70, 30, (char *)"Reset");
+Image image = Image(400, 130, 64, 48, picture);
+Label title = Label(300, 150, (char *)"Tiles drawn by more than one thread", Arial_12);
+
+static void values(uint32_t frame)
+{
+    for (int i = 0; i < 4; i++)
+        levels[i] = 50 + 45 * sinf(frame * 0.05f * (i + 1));
+    load = 50 + 40 * sinf(frame * 0.031f);
+    temperature = 21.5f + 3 * cosf(frame * 0.017f);
+    counter = frame;
+
+    for (int i = 0; i < 4; i++)
+        bars[i].setValue(levels[i]);
+    donut.setValue(load);
+    slider.setValue(levels[0]);
+    chart.addSample(load);
+    for (int i = 0; i < 64 * 48; i++)
+        picture[i] = (i + frame * 97) * 2654435761u >> 16;
+    image.invalidate();
+}
+
+FrameOp ops[2][1500];
+uint16_t pixels[2][8192];
+FrameRecord records[2] = {{ops[0], 1500, pixels[0], 8192}, {ops[1], 1500, pixels[1], 8192}};
+// a frame in many parts
+FrameRecord smallRecords[2] = {{ops[0], 40, pixels[0], 300}, {ops[1], 40, pixels[1], 300}};
+uint16_t bins[16384];
+
+static uint16_t reference[FRAMES][PANELPIXELS];
+
+// false at the first frame that differs from the one of update()
+static bool run(const char *name, FrameRecord *frameRecords, TileRenderer *tiles)
+{
+    memset(history, 0, sizeof(history));
+    chart.clear();
+    memset(tft.panel, 0, sizeof(tft.panel));
+
+    uint32_t split = tft.getRecordsSplit();
+    uint32_t steals = tiles != NULL ? tiles->getSteals() : 0;
+
+    BUI ui(&tft, &ts);
+    tft.setRotation(1);
+    ui.TS_MINX = 0;
+    ui.TS_MAXX = 480;
+    ui.TS_MINY = 0;
+    ui.TS_MAXY = 320;
+    ui.initNewScreen();
+    ui.enableRedrawOnChange(true);
+    for (int i = 0; i < 4; i++)
+        ui.addControl(&bars[i]);
+    ui.addControl(&donut);
+    ui.addControl(&chart);
+    ui.addControl(&lblLoad);
+    ui.addControl(&lblTemperature);
+    ui.addControl(&lblCounter);
+    ui.addControl(&slider);
+    ui.addControl(&button);
+    ui.addControl(&image);
+    ui.addControl(&title);
+
+    if (frameRecords != NULL)
+        ui.enablePipeline(frameRecords, 2);
+    if (tiles != NULL)
+        ui.setTileRenderer(tiles);
+
+    bool same = true;
+    for (uint32_t frame = 0; frame < FRAMES && same; frame++)
+    {
+        // press the button and drag the slider, after the touch delays of BUI so every touch is taken
+        if (frame == 10)
+        {
+            delay(260);
+            ts.press(430, 215);
+        }
+        else if (frame >= 30 && frame < 34)
+        {
+            delay(frame == 30 ? 260 : 40);
+            ts.press(350 + (frame - 30) * 30, 300);
+        }
+        else
+            ts.release();
+
+        values(frame);
+        ui.update();
+        // waits until the frame is sent
+        ui.enableAsyncUpdate(false);
+
+        if (frameRecords == NULL)
+            memcpy(reference[frame], tft.panel, sizeof(tft.panel));
+        else if (memcmp(reference[frame], tft.panel, sizeof(tft.panel)) != 0)
+        {
+            printf("  %-28s frame %u DIFFERENT\n", name, frame);
+            same = false;
+        }
+    }
+    ts.release();
+    ui.enablePipeline(NULL, 0);
+
+    if (same)
+        printf("  %-28s %d frames same, %u records split, %u tiles stolen\n", name, FRAMES, tft.getRecordsSplit() - split,
+               tiles != NULL ? tiles->getSteals() - steals : 0);
+    return same;
+}
+
+int main()
+{
+    bool same = run("update()", NULL, NULL);
+    same = same && run("pipeline, replay", records, NULL);
+    same = same && run("pipeline, small records", smallRecords, NULL);
+
+    char name[40];
+    for (uint8_t threads = 1; threads <= 4 && same; threads++)
+    {
+        TileRenderer binned(bins, sizeof(bins) / sizeof(bins[0]));
+        TileRenderer unbinned;
+        TileRenderer tooSmall(bins, 8);
+        binned.begin(threads);
+        unbinned.begin(threads);
+        tooSmall.begin(threads);
+
+        snprintf(name, sizeof(name), "tiles, %u threads", threads);
+        same = same && run(name, records, &binned);
+        snprintf(name, sizeof(name), "tiles, %u threads, no bins", threads);
+        same = same && run(name, records, &unbinned);
+        snprintf(name, sizeof(name), "tiles, %u threads, few bins", threads);
+        same = same && run(name, records, &tooSmall);
+        snprintf(name, sizeof(name), "tiles, %u threads, small rec", threads);
+        same = same && run(name, smallRecords, &binned);
+    }
+
+    printf(same ? "ok\n" : "FAILED\n");
+    return same ? 0 : 1;
+}
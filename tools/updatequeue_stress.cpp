@@ -0,0 +1,137 @@
+/*
+ * Author: https://github.com/sepp89117/
+ * Source: https://github.com/sepp89117/Teensy_UI
+ * Date: 2026-10-19
+ *
+ * Host stress test of UpdateQueue (src/UpdateQueue.h): producer threads post numbered values and texts as fast as
+ * they can, one queue per producer, while the consumer takes them over like BUI::update().
+ * A producer posts again while its queue is full, so every message has to arrive once, in order and unchanged.
+ * Posts that found the queue full are counted by dropped().
+ *
+ *   g++ -O2 -pthread -o updatequeue_stress tools/updatequeue_stress.cpp && ./updatequeue_stress
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#include "../src/UpdateQueue.h"
+
+#define PRODUCERS 3
+#define MESSAGES 500000
+
+// consumer in place of BUI, which is the friend that may read the queues
+class BUI
+{
+public:
+    uint32_t received[PRODUCERS] = {};
+    uint32_t wrong = 0;
+    uint32_t last[PRODUCERS] = {};
+
+    // takes over all posted messages of all queues, returns how many
+    uint32_t drain(UpdateQueue *queues)
+    {
+        uint32_t n = 0;
+        for (int p = 0; p < PRODUCERS; p++)
+        {
+            UpdateQueue::message *m;
+            while ((m = queues[p].front()) != NULL)
+            {
+                check(p, m);
+                queues[p].pop();
+                n++;
+            }
+        }
+        return n;
+    }
+
+private:
+    void check(int p, UpdateQueue::message *m)
+    {
+        // the target names the producer, the value or the number in the text counts up
+        uint32_t sequence = (uint32_t)m->value;
+        if (m->kind == UpdateQueue::TEXT)
+        {
+            unsigned number = 0;
+            char text[UPDATETEXTLEN + 1];
+            sscanf(m->text, "%u", &number);
+            snprintf(text, sizeof(text), "%u text of %d", number, p);
+            if (strcmp(text, m->text) != 0)
+                wrong++;
+            sequence = number;
+        }
+        else if (m->kind != UpdateQueue::VALUE)
+            wrong++;
+
+        if (m->target != (void *)(intptr_t)(p + 1) || (received[p] > 0 && sequence <= last[p]))
+            wrong++;
+
+        last[p] = sequence;
+        received[p]++;
+    }
+};
+
+static UpdateQueue queues[PRODUCERS];
+static std::atomic<int> running;
+
+// every 4th message is a text, values are exact as float up to 2^24
+static void produce(int p)
+{
+    Control *target = (Control *)(intptr_t)(p + 1);
+    for (uint32_t i = 0; i < MESSAGES; i++)
+    {
+        if (i % 4 == 3)
+        {
+            char text[UPDATETEXTLEN + 1];
+            snprintf(text, sizeof(text), "%u text of %d", (unsigned)i, p);
+            while (!queues[p].post(target, text))
+                std::this_thread::yield();
+        }
+        else
+        {
+            while (!queues[p].post(target, (float)i))
+                std::this_thread::yield();
+        }
+    }
+    running--;
+}
+
+int main()
+{
+    BUI consumer;
+    running = PRODUCERS;
+
+    auto start = std::chrono::steady_clock::now();
+    std::thread producers[PRODUCERS];
+    for (int p = 0; p < PRODUCERS; p++)
+        producers[p] = std::thread(produce, p);
+
+    uint64_t total = 0;
+    while (running > 0)
+    {
+        uint32_t n = consumer.drain(queues);
+        if (n == 0)
+            std::this_thread::yield();
+        total += n;
+    }
+    for (int p = 0; p < PRODUCERS; p++)
+        producers[p].join();
+    total += consumer.drain(queues);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    uint64_t full = 0;
+    for (int p = 0; p < PRODUCERS; p++)
+        full += queues[p].dropped();
+
+    printf("%d producers, %d messages each, UPDATEQUEUESIZE %d\n", PRODUCERS, MESSAGES, UPDATEQUEUESIZE);
+    printf("received %llu, posted again (queue full) %llu, wrong %u\n", (unsigned long long)total,
+           (unsigned long long)full, (unsigned)consumer.wrong);
+    printf("%.1f million messages per second taken over\n", total / seconds / 1e6);
+
+    bool ok = consumer.wrong == 0 && total == (uint64_t)PRODUCERS * MESSAGES;
+    printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}